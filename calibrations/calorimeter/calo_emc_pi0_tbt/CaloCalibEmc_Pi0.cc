@@ -472,50 +472,16 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
 
   std::cout << "in loop" << std::endl;
 
-  TTree *t1 = intree;
-  if (!intree)
-  {
-    TFile *f = new TFile(filename.c_str());
-    f->GetObject("_eventTree", t1);
-    if (!t1)
-    {
-      std::cout << PHWHERE << " could not load _eventTree from " << filename << std::endl;
-      gSystem->Exit(1);
-      exit(1);
-    }
-  }
-
-  // Set Branches
-  //  t1->SetBranchAddress("_eventNumber", &_eventNumber);
-  t1->SetBranchAddress("_nClusters", &_nClusters);
-  //  t1->SetBranchAddress("_clusterIDs", _clusterIDs);
-  t1->SetBranchAddress("_clusterEnergies", _clusterEnergies);
-  t1->SetBranchAddress("_clusterPts", _clusterPts);
-  t1->SetBranchAddress("_clusterEtas", _clusterEtas);
-  t1->SetBranchAddress("_clusterPhis", _clusterPhis);
-  t1->SetBranchAddress("_maxTowerEtas", _maxTowerEtas);
-  t1->SetBranchAddress("_maxTowerPhis", _maxTowerPhis);
-
-  // pre-loop to save all the clusters LorentzVector
-
-  TLorentzVector *savClusLV[10000];
-
-  //  int nEntries = (int) t1->GetEntriesFast();
-  int nEntries = (int) t1->GetEntries();
-  int nevts2 = nevts;
-
-  if (nevts < 0 || nEntries < nevts)
-  {
-    nevts2 = nEntries;
-  }
+  int nevts2 = open_event_source(nevts, filename, intree);
 
   // keeping track of discarded clusters for v7
   int discarded_clusters = 0;
 
   for (int i = 0; i < nevts2; i++)
   {
-    // load the ith instance of the TTree
-    t1->GetEntry(i);
+    // load the ith event from the TTree or the cluster cache
+    int nClusters = 0;
+    const ClusterRecord *clusters = event_clusters(i, nClusters);
 
     if ((i % 10 == 0 && i < 200) || (i % 100 == 0 && i < 1000) || (i % 1000 == 0 && i < 37003) || i % 10000 == 0)
     {
@@ -523,8 +489,6 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
     }
     // calibration correction will be applied here
 
-    int nClusters = _nClusters;
-
     // see below this is like centrality cut, but currently need central events
     // as well as peripheral to maximize statistical power
     if (nClusters > 1000)
@@ -536,6 +500,12 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
     float pt1cut = 0;
     float pt2cut = 0;
 
+    // photon candidates are reused, no allocation per cluster
+    if (m_clusLV.size() < static_cast<std::size_t>(nClusters))
+    {
+      m_clusLV.resize(nClusters);
+    }
+
     for (int j = 0; j < nClusters; j++)
     {
       // float px, py, pz;
@@ -544,15 +514,15 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
       float phi;
       float E;
       float aggcv;
-      pt = _clusterPts[j];
-      eta = _clusterEtas[j];
-      phi = _clusterPhis[j];
-      E = _clusterEnergies[j];
+      pt = clusters[j].pt;
+      eta = clusters[j].eta;
+      phi = clusters[j].phi;
+      E = clusters[j].E;
       // px  =  pt * cos(phi);
       // py  =  pt * sin(phi);
       // pz  =  pt * sinh(eta);
       // pt *= myaggcorr[
-      aggcv = myaggcorr.at(_maxTowerEtas[j]).at(_maxTowerPhis[j]);
+      aggcv = myaggcorr.at(clusters[j].maxTowerEta).at(clusters[j].maxTowerPhi);
 
       // std::cout << "aggcv applied: " << aggcv << std::endl;
 
@@ -567,16 +537,15 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
       pt *= aggcv;
       E *= aggcv;
 
-      savClusLV[j] = new TLorentzVector();
-      savClusLV[j]->SetPtEtaPhiE(pt, eta, phi, E);
+      m_clusLV[j].SetPtEtaPhiE(pt, eta, phi, E);
     }
 
-    TLorentzVector *pho1;
-    TLorentzVector *pho2;
+    const TLorentzVector *pho1;
+    const TLorentzVector *pho2;
     int iCs = nClusters;
     for (int jCs = 0; jCs < iCs; jCs++)
     {
-      pho1 = savClusLV[jCs];
+      pho1 = &m_clusLV[jCs];
       /////////////////////////////////////////////////////////////////
       //////////////////////////////////////////////////////
       // *********************************
@@ -642,7 +611,7 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
           continue;
         }
 
-        pho2 = savClusLV[kCs];
+        pho2 = &m_clusLV[kCs];
 
         if (std::abs(pho2->Pt()) < pt2cut)
         {
@@ -671,16 +640,17 @@ void CaloCalibEmc_Pi0::Loop(int nevts, const std::string &filename, TTree *intre
           // fill the tower by tower histograms with invariant mass
           // cemc_hist_eta_phi[_maxTowerEtas[jCs]][_maxTowerPhis[jCs]]->Fill(pairInvMass);
           // not useful in summer 23 data
-          eta_hist.at(_maxTowerEtas[jCs])->Fill(pairInvMass);
+          eta_hist.at(clusters[jCs].maxTowerEta)->Fill(pairInvMass);
           pt1_ptpi0_alpha->Fill(pho1->Pt(), pi0lv.Pt(), alphaCut);
           pairInvMassTotal->Fill(pairInvMass);
-          mass_eta->Fill(pairInvMass, _clusterEtas[jCs]);
-          mass_eta_phi->Fill(pairInvMass, _clusterEtas[jCs], _clusterPhis[jCs]);
+          mass_eta->Fill(pairInvMass, clusters[jCs].eta);
+          mass_eta_phi->Fill(pairInvMass, clusters[jCs].eta, clusters[jCs].phi);
         }
       }
     }
   }
-  std::cout << "total number of events: " << nEntries << std::endl;
+  close_event_source();
+  std::cout << "total number of events: " << nevts2 << std::endl;
   std::cout << "total number of events discarded: " << discarded_clusters << std::endl;
 }
 
@@ -734,47 +704,13 @@ void CaloCalibEmc_Pi0::Loop_for_eta_slices(int nevts, const std::string &filenam
 
   std::cout << "in loop" << std::endl;
 
-  TTree *t1 = intree;
-  if (!intree)
-  {
-    TFile *f = new TFile(filename.c_str());
-    f->GetObject("_eventTree", t1);
-    if (!t1)
-    {
-      std::cout << PHWHERE << " could not load _eventTree from " << filename << std::endl;
-      gSystem->Exit(1);
-      exit(1);
-    }
-  }
-
-  // Set Branches
-  //  t1->SetBranchAddress("_eventNumber", &_eventNumber);
-  t1->SetBranchAddress("_nClusters", &_nClusters);
-  //  t1->SetBranchAddress("_clusterIDs", _clusterIDs);
-  t1->SetBranchAddress("_clusterEnergies", _clusterEnergies);
-  t1->SetBranchAddress("_clusterPts", _clusterPts);
-  t1->SetBranchAddress("_clusterEtas", _clusterEtas);
-  t1->SetBranchAddress("_clusterPhis", _clusterPhis);
-  t1->SetBranchAddress("_maxTowerEtas", _maxTowerEtas);
-  t1->SetBranchAddress("_maxTowerPhis", _maxTowerPhis);
-
-  // pre-loop to save all the clusters LorentzVector
-
-  std::array<TLorentzVector *, 10000> savClusLV{};
-
-  //  int nEntries = (int) t1->GetEntriesFast();
-  int nEntries = (int) t1->GetEntries();
-  int nevts2 = nevts;
-
-  if (nevts < 0 || nEntries < nevts)
-  {
-    nevts2 = nEntries;
-  }
+  int nevts2 = open_event_source(nevts, filename, intree);
 
   for (int i = 0; i < nevts2; i++)
   {
-    // load the ith instance of the TTree
-    t1->GetEntry(i);
+    // load the ith event from the TTree or the cluster cache
+    int nClusters = 0;
+    const ClusterRecord *clusters = event_clusters(i, nClusters);
 
     if ((i % 10 == 0 && i < 200) || (i % 100 == 0 && i < 1000) || (i % 1000 == 0 && i < 37003) || i % 10000 == 0)
     {
@@ -782,13 +718,17 @@ void CaloCalibEmc_Pi0::Loop_for_eta_slices(int nevts, const std::string &filenam
     }
     // calibration correction will be applied here
 
-    int nClusters = _nClusters;
-
     if (nClusters > 60)
     {
       continue;
     }
 
+    // photon candidates are reused, no allocation per cluster
+    if (m_clusLV.size() < static_cast<std::size_t>(nClusters))
+    {
+      m_clusLV.resize(nClusters);
+    }
+
     for (int j = 0; j < nClusters; j++)
     {
       // float px, py, pz;
@@ -797,25 +737,24 @@ void CaloCalibEmc_Pi0::Loop_for_eta_slices(int nevts, const std::string &filenam
       float phi;
       float E;
       float aggcv;
-      pt = _clusterPts[j];
-      eta = _clusterEtas[j];
-      phi = _clusterPhis[j];
-      E = _clusterEnergies[j];
-      aggcv = myaggcorr.at(_maxTowerEtas[j]).at(_maxTowerPhis[j]);
+      pt = clusters[j].pt;
+      eta = clusters[j].eta;
+      phi = clusters[j].phi;
+      E = clusters[j].E;
+      aggcv = myaggcorr.at(clusters[j].maxTowerEta).at(clusters[j].maxTowerPhi);
 
       pt *= aggcv;
       E *= aggcv;
 
-      savClusLV.at(j) = new TLorentzVector();
-      savClusLV.at(j)->SetPtEtaPhiE(pt, eta, phi, E);
+      m_clusLV[j].SetPtEtaPhiE(pt, eta, phi, E);
     }
 
-    TLorentzVector *pho1;
-    TLorentzVector *pho2;
+    const TLorentzVector *pho1;
+    const TLorentzVector *pho2;
     int iCs = nClusters;
     for (int jCs = 0; jCs < iCs; jCs++)
     {
-      pho1 = savClusLV.at(jCs);
+      pho1 = &m_clusLV[jCs];
 
       if (std::abs(pho1->Pt()) < 1.0)
       {
@@ -830,7 +769,7 @@ void CaloCalibEmc_Pi0::Loop_for_eta_slices(int nevts, const std::string &filenam
           continue;
         }
 
-        pho2 = savClusLV.at(kCs);
+        pho2 = &m_clusLV[kCs];
 
         if (std::abs(pho2->Pt()) < 0.6)
         {
@@ -874,12 +813,139 @@ void CaloCalibEmc_Pi0::Loop_for_eta_slices(int nevts, const std::string &filenam
         // fill the tower by tower histograms with invariant mass
         // we don't need to fill tower-by-tower level when we do for eta slices
         // although filling here just so we don't have to change codes in other places
-        cemc_hist_eta_phi.at(_maxTowerEtas[jCs]).at(_maxTowerPhis[jCs])->Fill(pairInvMass);
-        eta_hist.at(_maxTowerEtas[jCs])->Fill(pairInvMass);
+        cemc_hist_eta_phi.at(clusters[jCs].maxTowerEta).at(clusters[jCs].maxTowerPhi)->Fill(pairInvMass);
+        eta_hist.at(clusters[jCs].maxTowerEta)->Fill(pairInvMass);
         // pt1_ptpi0_alpha->Fill(pho1->Pt(), pi0lv.Pt(), alphaCut);
       }
     }
   }
+  close_event_source();
+}
+
+//____________________________________________________________________________..
+int CaloCalibEmc_Pi0::open_event_source(int nevts, const std::string &filename, TTree *intree)
+{
+  if (m_cacheValid && filename == m_cacheFilename && intree == m_cacheInTree)
+  {
+    int nevts2 = nevts;
+    if (nevts < 0 || m_cacheEntries < nevts)
+    {
+      nevts2 = m_cacheEntries;
+    }
+    if (nevts2 <= m_cacheNevts)
+    {
+      std::cout << "using " << nevts2 << " events from cluster cache" << std::endl;
+      return nevts2;
+    }
+  }
+  clear_cluster_cache();
+
+  TTree *t1 = intree;
+  if (!intree)
+  {
+    TFile *f = new TFile(filename.c_str());
+    f->GetObject("_eventTree", t1);
+    if (!t1)
+    {
+      std::cout << PHWHERE << " could not load _eventTree from " << filename << std::endl;
+      gSystem->Exit(1);
+      exit(1);
+    }
+  }
+
+  // Set Branches
+  //  t1->SetBranchAddress("_eventNumber", &_eventNumber);
+  t1->SetBranchAddress("_nClusters", &_nClusters);
+  //  t1->SetBranchAddress("_clusterIDs", _clusterIDs);
+  t1->SetBranchAddress("_clusterEnergies", _clusterEnergies);
+  t1->SetBranchAddress("_clusterPts", _clusterPts);
+  t1->SetBranchAddress("_clusterEtas", _clusterEtas);
+  t1->SetBranchAddress("_clusterPhis", _clusterPhis);
+  t1->SetBranchAddress("_maxTowerEtas", _maxTowerEtas);
+  t1->SetBranchAddress("_maxTowerPhis", _maxTowerPhis);
+  m_evtTree = t1;
+
+  //  int nEntries = (int) t1->GetEntriesFast();
+  int nEntries = (int) t1->GetEntries();
+  int nevts2 = nevts;
+
+  if (nevts < 0 || nEntries < nevts)
+  {
+    nevts2 = nEntries;
+  }
+
+  if (m_cacheClusters)
+  {
+    m_cacheFilename = filename;
+    m_cacheInTree = intree;
+    m_cacheEntries = nEntries;
+    m_cacheOffsets.reserve(nevts2 + 1);
+    m_cacheOffsets.push_back(0);
+    m_cacheNClusters.reserve(nevts2);
+  }
+  return nevts2;
+}
+
+//____________________________________________________________________________..
+const CaloCalibEmc_Pi0::ClusterRecord *CaloCalibEmc_Pi0::event_clusters(int ievt, int &nClusters)
+{
+  if (m_cacheValid)
+  {
+    nClusters = m_cacheNClusters[ievt];
+    return m_cacheRecords.data() + m_cacheOffsets[ievt];
+  }
+
+  m_evtTree->GetEntry(ievt);
+  nClusters = _nClusters;
+  // the Loops skip these events, no need to keep their clusters
+  const int nstore = (nClusters > kMaxClustersPerEvent) ? 0 : std::max(nClusters, 0);
+
+  std::vector<ClusterRecord> &records = m_cacheClusters ? m_cacheRecords : m_evtRecords;
+  const std::size_t offset = m_cacheClusters ? records.size() : 0;
+  records.resize(offset + nstore);
+  for (int j = 0; j < nstore; j++)
+  {
+    ClusterRecord &rec = records[offset + j];
+    rec.pt = _clusterPts[j];
+    rec.eta = _clusterEtas[j];
+    rec.phi = _clusterPhis[j];
+    rec.E = _clusterEnergies[j];
+    rec.maxTowerEta = _maxTowerEtas[j];
+    rec.maxTowerPhi = _maxTowerPhis[j];
+  }
+  if (m_cacheClusters)
+  {
+    m_cacheOffsets.push_back(records.size());
+    m_cacheNClusters.push_back(nClusters);
+  }
+  return records.data() + offset;
+}
+
+//____________________________________________________________________________..
+void CaloCalibEmc_Pi0::close_event_source()
+{
+  if (m_evtTree && m_cacheClusters)
+  {
+    m_cacheNevts = m_cacheNClusters.size();
+    m_cacheValid = true;
+    std::cout << "cached " << m_cacheRecords.size() << " clusters of "
+              << m_cacheNevts << " events" << std::endl;
+  }
+  m_evtTree = nullptr;
+}
+
+//____________________________________________________________________________..
+void CaloCalibEmc_Pi0::clear_cluster_cache()
+{
+  m_cacheValid = false;
+  m_cacheFilename.clear();
+  m_cacheInTree = nullptr;
+  m_cacheEntries = 0;
+  m_cacheNevts = 0;
+  // swap with empty vectors to release the memory
+  std::vector<ClusterRecord>().swap(m_cacheRecords);
+  std::vector<std::size_t>().swap(m_cacheOffsets);
+  std::vector<int>().swap(m_cacheNClusters);
 }
 
 // _______________________________________________________________..
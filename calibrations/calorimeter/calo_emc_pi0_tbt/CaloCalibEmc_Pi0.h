@@ -5,14 +5,17 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <TLorentzVector.h>
+
 #include <array>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 class TFile;
 class TH1;
 class TH2;
 class TH3;
-class TH1;
 class TTree;
 
 class CaloCalibEmc_Pi0 : public SubsysReco
@@ -72,7 +75,44 @@ class CaloCalibEmc_Pi0 : public SubsysReco
     _setMassVal = insetval;
   }
 
+  //! keep the clusters of the event tree in memory after the first Loop/Loop_for_eta_slices call
+  //! following calls on the same input (e.g. the next iteration with a new incorrFile)
+  //! do not read the tree again. Costs 24 bytes per cluster
+  void set_cacheClusters(bool b)
+  {
+    m_cacheClusters = b;
+    if (!b)
+    {
+      clear_cluster_cache();
+    }
+  }
+
+  //! release the memory of the cluster cache
+  void clear_cluster_cache();
+
  private:
+  //! the tree variables used by the Loops
+  struct ClusterRecord
+  {
+    float pt{0};
+    float eta{0};
+    float phi{0};
+    float E{0};
+    int maxTowerEta{0};
+    int maxTowerPhi{0};
+  };
+
+  //! events with more clusters are not stored, the Loops skip them anyway
+  static constexpr int kMaxClustersPerEvent = 1000;
+
+  //! set up reading of the event tree or the cluster cache, returns number of events to loop over
+  int open_event_source(int nevts, const std::string &filename, TTree *intree);
+  //! clusters of event ievt, nClusters is set to the number of clusters in the tree
+  //! which is larger than the number of returned records for events above kMaxClustersPerEvent
+  const ClusterRecord *event_clusters(int ievt, int &nClusters);
+  //! done with the event loop, the cache is complete now
+  void close_event_source();
+
   //  float setMassVal = 0.135;
   float _setMassVal{0.152};
   // currently defaulting to 0.152 to match sim
@@ -125,6 +165,21 @@ class CaloCalibEmc_Pi0 : public SubsysReco
   TFile *f_temp{nullptr};
 
   int m_UseTowerInfo{0};  // 0 only old tower, 1 only new (TowerInfo based),
+
+  // cluster cache, records of event i are [m_cacheOffsets[i], m_cacheOffsets[i+1])
+  bool m_cacheClusters{false};
+  bool m_cacheValid{false};
+  TTree *m_evtTree{nullptr};
+  std::string m_cacheFilename;
+  TTree *m_cacheInTree{nullptr};
+  int m_cacheEntries{0};
+  int m_cacheNevts{0};
+  std::vector<ClusterRecord> m_cacheRecords;
+  std::vector<std::size_t> m_cacheOffsets;
+  std::vector<int> m_cacheNClusters;
+  std::vector<ClusterRecord> m_evtRecords;
+  // photon candidates, reused event by event
+  std::vector<TLorentzVector> m_clusLV;
 };
 
 #endif  //   CALOEMCPI0TBT_CALOCALIBEMC_PI0_H
@@ -16,6 +16,33 @@ AfterburnerAlgo::AfterburnerAlgo( flowAfterburnerAlgorithm algorithm)
     m_vn[i] = 0.0;
     m_vn_scalefactors[i] = 1.0;
   }
+  update_coefficients();
+}
+
+void AfterburnerAlgo::update_coefficients()
+{
+  const double b = m_impact_parameter;
+  m_a1 = 0.4397 * exp(-(b - 4.526) * (b - 4.526) / 72.0) + 0.636;
+  m_a2 = 1.916 / (b + 2) + 0.1;
+  m_a3 = 4.79 * 0.0001 * (b - 0.621) * (b - 10.172) * (b - 23) + 1.2;  // this is >0 for b>0
+  m_a4 = 0.135 * exp(-0.5 * (b - 10.855) * (b - 10.855) / 4.607 / 4.607) + 0.0120;
+
+  m_fb_factor = 0.97 + (1.06 * exp(-0.5 * b * b / 3.2 / 3.2));
+  m_gb_factor = 1.096 + (1.36 * exp(-0.5 * b * b / 3.0 / 3.0));
+
+  // calc polynomial
+  // parameters are from fit of sigma to centrality, sampled over HIJING b
+  const std::array<float, 8> coeffs = {
+      -7.00411e-09, 4.24567e-07, 
+      -9.87748e-06, 0.000112689,
+      -0.000694686, 0.002413930, 
+      -0.00324709, 0.0107906};
+  float sigma = 0.0;
+  for (float coeff : coeffs) 
+  {
+      sigma = sigma * b + coeff;
+  }
+  m_sigma = std::max<double>(sigma, 0.0);
 }
 
 void AfterburnerAlgo::set_single_scale_N( const unsigned int n, const float scale )
@@ -46,13 +73,12 @@ float AfterburnerAlgo::get_vn(unsigned int n) const
   return m_vn[n - 1];
 }
 
-float AfterburnerAlgo::calc_v2(double b, double eta, double pt)
+float AfterburnerAlgo::calc_v2(double eta, double pt) const
 {
-    
-    float a1 = 0.4397 * exp(-(b - 4.526) * (b - 4.526) / 72.0) + 0.636;
-    float a2 = 1.916 / (b + 2) + 0.1;
-    float a3 = 4.79 * 0.0001 * (b - 0.621) * (b - 10.172) * (b - 23) + 1.2;  // this is >0 for b>0
-    float a4 = 0.135 * exp(-0.5 * (b - 10.855) * (b - 10.855) / 4.607 / 4.607) + 0.0120;
+    const float a1 = m_a1;
+    const float a2 = m_a2;
+    const float a3 = m_a3;
+    const float a4 = m_a4;
 
     float temp1 = pow(pt, a1) / (1 + exp((pt - 3.0) / a3));
     float temp2 = pow(pt + 0.1, -a2) / (1 + exp(-(pt - 4.5) / a3));
@@ -86,17 +112,11 @@ void AfterburnerAlgo::calc_flow(double eta, double pt, CLHEP::HepRandomEngine* e
     else if (m_algorithm == minbias_algorithm)
     { // all other algorithms need to calculate the flow
         v1 = 0;
-        v2 = AfterburnerAlgo::calc_v2(m_impact_parameter, eta, pt); 
+        v2 = calc_v2(eta, pt); 
         float v2_sqrt = std::sqrt(v2);
 
-        float fb = (
-            0.97 
-            + (1.06 * exp(-0.5 * m_impact_parameter * m_impact_parameter / 3.2 / 3.2))
-         ) * v2_sqrt;
-        float gb = (
-            1.096 
-            + (1.36 * exp(-0.5 * m_impact_parameter * m_impact_parameter / 3.0 / 3.0))
-         ) * v2_sqrt;
+        float fb = m_fb_factor * v2_sqrt;
+        float gb = m_gb_factor * v2_sqrt;
 
         v3 = pow( fb , 3);
         v4 = pow( gb, 4);
@@ -106,7 +126,7 @@ void AfterburnerAlgo::calc_flow(double eta, double pt, CLHEP::HepRandomEngine* e
     else if (m_algorithm == minbias_v2_algorithm)
     { // only v2 is calculated
         v1 = 0;
-        v2 = AfterburnerAlgo::calc_v2(m_impact_parameter, eta, pt);
+        v2 = calc_v2(eta, pt);
         v3 = 0;
         v4 = 0;
         v5 = 0;
@@ -133,27 +153,9 @@ void AfterburnerAlgo::calc_flow(double eta, double pt, CLHEP::HepRandomEngine* e
 
 void AfterburnerAlgo::flucatate(CLHEP::HepRandomEngine* engine, float &v1, float &v2, float &v3, float &v4, float &v5, float &v6) const
 {
-  // calc polynomial
-  // parameters are from fit of sigma to centrality, sampled over HIJING b
-  const std::array<float, 8> coeffs = {
-      -7.00411e-09, 4.24567e-07, 
-      -9.87748e-06, 0.000112689,
-      -0.000694686, 0.002413930, 
-      -0.00324709, 0.0107906};
-  float sigma = 0.0;
-  for (float coeff : coeffs) 
-  {
-      sigma = sigma * m_impact_parameter + coeff;
-  }
-  sigma = std::max<double>(sigma, 0.0);
-  const float fb = (
-          0.97 
-          + (1.06 * exp(-0.5 * m_impact_parameter * m_impact_parameter / 3.2 / 3.2))
-        ) * std::sqrt(v2);
-  const float gb = (
-      1.096 
-      + (1.36 * exp(-0.5 * m_impact_parameter * m_impact_parameter / 3.0 / 3.0))
-    ) * std::sqrt(v2);
+  const float sigma = m_sigma;
+  const float fb = m_fb_factor * std::sqrt(v2);
+  const float gb = m_gb_factor * std::sqrt(v2);
 
   const float s1 = 0; // Not implemented, v1 is always 0
   const float s2 = sigma;
@@ -30,10 +30,15 @@ class AfterburnerAlgo
 
     void print( std::ostream &os = std::cout) const; // debugging output
 
-    // set by an event
+    // set by an event, updates the impact parameter dependent coefficients
+    // of the flow parametrization if b changed
     void set_impact_parameter(double b)
     {
-      m_impact_parameter = b;
+      if (b != m_impact_parameter)
+      {
+        m_impact_parameter = b;
+        update_coefficients();
+      }
     }
 
 
@@ -61,7 +66,18 @@ class AfterburnerAlgo
     float m_vn_scalefactors[6] = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0}; // scale factors for v1 to v6
     bool _do_fluctuations = false; // enable or disable event-by-event fluctuations flow
 
-    static float calc_v2(double b, double eta, double pt);
+    float calc_v2(double eta, double pt) const;
+
+    // impact parameter dependent parts of calc_v2, calc_flow and flucatate
+    // they are the same for all particles of an event
+    void update_coefficients();
+    float m_a1 = 0.0;
+    float m_a2 = 0.0;
+    float m_a3 = 0.0;
+    float m_a4 = 0.0;
+    double m_fb_factor = 0.0; // v3 = (m_fb_factor * sqrt(v2))^3
+    double m_gb_factor = 0.0; // v4..6 = (m_gb_factor * sqrt(v2))^n
+    float m_sigma = 0.0; // width of the event-by-event fluctuations
 
 
 };
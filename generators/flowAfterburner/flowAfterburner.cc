@@ -39,12 +39,24 @@
 #include <ctime>  // for time
 #include <string>
 #include <algorithm>  // for max, min
+#include <memory>     // for unique_ptr
 
 namespace CLHEP
 {
   class HepRandomEngine;
 }
 
+namespace
+{
+  // one brent solver per thread, allocated on first use and reused for all particles
+  gsl_root_fsolver *brent_fsolver()
+  {
+    static thread_local std::unique_ptr<gsl_root_fsolver, decltype(&gsl_root_fsolver_free)>
+        solver(gsl_root_fsolver_alloc(gsl_root_fsolver_brent), &gsl_root_fsolver_free);
+    return solver.get();
+  }
+}  // namespace
+
 Afterburner::Afterburner( const std::string &algorithmName,
                           CLHEP::HepRandomEngine *engine,
                           float mineta, float maxeta,
@@ -91,6 +103,7 @@ Afterburner::Afterburner(Afterburner&& o) noexcept
   , m_minpt(o.m_minpt)
   , m_maxpt(o.m_maxpt)
   , m_phishift(o.m_phishift)
+  , m_phisolver(o.m_phisolver)
 {
   std::copy(std::begin(o.m_psi_n), std::end(o.m_psi_n), std::begin(m_psi_n));
   o.m_algo = nullptr;  
@@ -124,6 +137,7 @@ Afterburner& Afterburner::operator=(Afterburner&& o) noexcept
     m_minpt  = o.m_minpt;  
     m_maxpt  = o.m_maxpt;
     m_phishift = o.m_phishift;
+    m_phisolver = o.m_phisolver;
     std::copy(std::begin(o.m_psi_n), std::end(o.m_psi_n), std::begin(m_psi_n));
   }
   return *this;
@@ -205,11 +219,96 @@ double Afterburner::vn_func(double x, void* params)
   const float* psi  = par + 7;
   double s = 0.0;
   for (int n = 1; n <= 6; ++n) {
+    // harmonics without flow add exactly zero, skip their sin
+    if (vn[n-1] == 0)
+    {
+      continue;
+    }
     s += vn[n-1] * std::sin(static_cast<double>(n) * (x - psi[n-1])) / static_cast<double>(n);
   }
   return (x + 2.0 * s) - phi0;
 }
 
+bool Afterburner::solve_phi_brent(float *params, double &phi)
+{
+  gsl_root_fsolver *s = brent_fsolver();
+  double x_lo = -2 * M_PI;
+  double x_hi = 2 * M_PI;
+
+  gsl_function F;
+  F.function = &Afterburner::vn_func;
+  F.params = params;
+  gsl_root_fsolver_set(s, &F, x_lo, x_hi);
+
+  int status;
+  int iter = 0;
+  do
+  {
+    ++iter;
+    gsl_root_fsolver_iterate(s);
+    phi  = gsl_root_fsolver_root(s);
+    x_lo = gsl_root_fsolver_x_lower(s);
+    x_hi = gsl_root_fsolver_x_upper(s);
+    status = gsl_root_test_interval(x_lo, x_hi, 0, 1e-5);
+  } while (status == GSL_CONTINUE && iter < 1000);
+
+  return iter < 1000;
+}
+
+bool Afterburner::solve_phi_newton(const float *params, double &phi)
+{
+  const double phi0 = params[0];
+  const float* vn   = params + 1;
+  const float* psi  = params + 7;
+  // f(x) = vn_func(x) is increasing as long as sum(vn) < 1/2, the bracket
+  // keeps the iteration safe otherwise
+  double x_lo = -2 * M_PI;
+  double x_hi = 2 * M_PI;
+  // the shift is small, phi0 is a good start value
+  double x = phi0;
+  for (int iter = 0; iter < 100; ++iter)
+  {
+    double f = x - phi0;
+    double df = 1.0;
+    for (int n = 1; n <= 6; ++n)
+    {
+      if (vn[n-1] == 0)
+      {
+        continue;
+      }
+      const double arg = static_cast<double>(n) * (x - psi[n-1]);
+      f += 2.0 * vn[n-1] * std::sin(arg) / static_cast<double>(n);
+      df += 2.0 * vn[n-1] * std::cos(arg);
+    }
+    if (f == 0)
+    {
+      phi = x;
+      return true;
+    }
+    if (f < 0)
+    {
+      x_lo = x;
+    }
+    else
+    {
+      x_hi = x;
+    }
+    double x_new = x - f / df;
+    if (df <= 0 || x_new <= x_lo || x_new >= x_hi)
+    {
+      // Newton step leaves the bracket, bisect instead
+      x_new = 0.5 * (x_lo + x_hi);
+    }
+    if (std::abs(x_new - x) < 1e-7)
+    {
+      phi = x_new;
+      return true;
+    }
+    x = x_new;
+  }
+  return false;
+}
+
 
 void Afterburner::throw_psi_n(HepMC::GenEvent *event)
 {
@@ -261,10 +360,6 @@ void Afterburner::AddFlowToParentAndMoveDescendants(HepMC::GenEvent *event, HepM
   m_algo->set_impact_parameter(hi->impact_parameter());
   m_algo->calc_flow(eta, pt, m_engine); // add engine for fluctuations (if enabled)
 
-  const gsl_root_fsolver_type *T = gsl_root_fsolver_brent;
-  gsl_root_fsolver *s = gsl_root_fsolver_alloc(T);
-  double x_lo = -2 * M_PI;
-  double x_hi = 2 * M_PI;
   float params[13] = {};
   params[0]  = static_cast<float>(phi_0);
   for (int i = 0; i < 6; ++i) 
@@ -273,32 +368,22 @@ void Afterburner::AddFlowToParentAndMoveDescendants(HepMC::GenEvent *event, HepM
     params[7 + i] = getPsiN(i+1);
   }
 
-  gsl_function F;
-  F.function = &Afterburner::vn_func;
-  F.params = params;
-  gsl_root_fsolver_set(s, &F, x_lo, x_hi);
-
-  int status;
-  int iter = 0;
   double phi = 0;
-  do
+  bool solved = false;
+  if (m_phisolver == newton_solver)
+  {
+    solved = solve_phi_newton(params, phi);
+  }
+  if (!solved)
+  {
+    solved = solve_phi_brent(params, phi);
+  }
+  if (!solved)
   {
-    ++iter;
-    gsl_root_fsolver_iterate(s);
-    phi  = gsl_root_fsolver_root(s);
-    x_lo = gsl_root_fsolver_x_lower(s);
-    x_hi = gsl_root_fsolver_x_upper(s);
-    status = gsl_root_test_interval(x_lo, x_hi, 0, 1e-5);
-  } while (status == GSL_CONTINUE && iter < 1000);
-
-  if (iter >= 1000) {
-    gsl_root_fsolver_free(s);
     m_phishift = 0.0;
     return; // do not rotate anything on failure
   }
 
-  gsl_root_fsolver_free(s);
-
   m_phishift = phi - phi_0;
   if (fabs(m_phishift) > 1e-7)
   {
@@ -48,6 +48,18 @@ class Afterburner
   void setPtRange(float minpt, float maxpt);
 
   float getPsiN(unsigned int n) const;
+
+  //! root finder for the flow shifted azimuth
+  //! brent_solver: gsl brent solver, interval tolerance 1e-5 (default)
+  //! newton_solver: bracketed Newton iteration on the same equation, stops at
+  //! steps below 1e-7, typically after 3-4 evaluations, falls back to brent
+  enum PhiSolver
+  {
+    brent_solver,
+    newton_solver
+  };
+  void setPhiSolver(PhiSolver solver) { m_phisolver = solver; }
+  PhiSolver getPhiSolver() const { return m_phisolver; }
  
   static double vn_func(double x, void *params);
   void throw_psi_n(HepMC::GenEvent *event);
@@ -73,6 +85,12 @@ class Afterburner
   float m_maxpt = 100.0f;
   double m_phishift = 0.0; // shift of the reaction plane angle in phi, used to align with the impact parameter
 
+  PhiSolver m_phisolver = brent_solver;
+
+  // solve vn_func(phi, params) = 0, return false if not converged
+  static bool solve_phi_brent(float *params, double &phi);
+  static bool solve_phi_newton(const float *params, double &phi);
+
   void setPsiN(unsigned int n, float psi);
   float m_psi_n[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}; // reaction plane angles
 
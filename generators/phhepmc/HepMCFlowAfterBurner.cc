@@ -54,6 +54,10 @@ int HepMCFlowAfterBurner::Init(PHCompositeNode * /*topNode*/)
   m_engine = new CLHEP::MTwistEngine(randomSeed);
   m_afterburner = new Afterburner(algorithmName, m_engine, mineta, maxeta, minpt, maxpt);
   m_flowalgo = m_afterburner->getAlgo();
+  if (newtonPhiSolver)
+  {
+    m_afterburner->setPhiSolver(Afterburner::newton_solver);
+  }
   // you can set other algo parameters here if needed
   if (enableFlucuations)
   {
@@ -154,6 +158,7 @@ void HepMCFlowAfterBurner::Print(const std::string & /*what*/) const
   std::cout << "algorithm: " << algorithmName << std::endl;
   std::cout << "mineta: " << mineta << ", maxeta: " << maxeta << std::endl;
   std::cout << "minpt: " << minpt << ", maxpt: " << maxpt << std::endl;
+  std::cout << "phi solver: " << (newtonPhiSolver ? "newton" : "brent") << std::endl;
   std::cout << "Implemented algorithms: MINBIAS (default), MINBIAS_V2_ONLY, CUSTOM"
             << std::endl;
   return;
@@ -58,6 +58,13 @@ class HepMCFlowAfterBurner : public SubsysReco
 
   void scaleFlow(const float scale, const unsigned int n = 0);
 
+  //! solve the flow shifted azimuth with a bracketed Newton iteration instead
+  //! of the gsl brent solver, agrees within the 1e-5 brent tolerance
+  void useNewtonPhiSolver(const bool use)
+  {
+    newtonPhiSolver = use;
+  }
+
   void SaveRandomState(const std::string &savefile = "HepMCFlowAfterBurner.ransave");
   void RestoreRandomState(const std::string &savefile = "HepMCFlowAfterBurner.ransave");
 
@@ -77,6 +84,7 @@ class HepMCFlowAfterBurner : public SubsysReco
   long randomSeed = 11793;
 
   bool enableFlucuations = true;                                           //  turns on/off the fluctuations in the afterburner
+  bool newtonPhiSolver = false;                                            //  Newton instead of brent root finder for the phi shift
   std::array<float, 6> flowScales = {1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F};  // scales for the flow harmonics
 
   Afterburner *m_afterburner = nullptr;
@@ -22,6 +22,7 @@
 
 #include <fun4all/Fun4AllHistoManager.h>
 #include <fun4all/Fun4AllReturnCodes.h>
+#include <fun4all/HistoFillBuffer.h>
 #include <fun4all/SubsysReco.h>
 
 #include <phool/PHCompositeNode.h>
@@ -98,19 +99,19 @@ int TpcClusterQA::process_event(PHCompositeNode *topNode)
 
   struct HistoList
   {
-    TH1 *crphisize_side0 = nullptr;
-    TH1 *crphisize_side1 = nullptr;
-    TH1 *czsize = nullptr;
-    TH1 *crphierr = nullptr;
-    TH1 *czerr = nullptr;
-    TH1 *cedge = nullptr;
-    TH1 *coverlap = nullptr;
-    TH1 *cxposition_side0 = nullptr;
-    TH1 *cxposition_side1 = nullptr;
-    TH1 *cyposition_side0 = nullptr;
-    TH1 *cyposition_side1 = nullptr;
-    TH1 *czposition_side0 = nullptr;
-    TH1 *czposition_side1 = nullptr;
+    HistoFillBuffer *crphisize_side0 = nullptr;
+    HistoFillBuffer *crphisize_side1 = nullptr;
+    HistoFillBuffer *czsize = nullptr;
+    HistoFillBuffer *crphierr = nullptr;
+    HistoFillBuffer *czerr = nullptr;
+    HistoFillBuffer *cedge = nullptr;
+    HistoFillBuffer *coverlap = nullptr;
+    HistoFillBuffer *cxposition_side0 = nullptr;
+    HistoFillBuffer *cxposition_side1 = nullptr;
+    HistoFillBuffer *cyposition_side0 = nullptr;
+    HistoFillBuffer *cyposition_side1 = nullptr;
+    HistoFillBuffer *czposition_side0 = nullptr;
+    HistoFillBuffer *czposition_side1 = nullptr;
   };
 
   int hitsetkeynum = 0;
@@ -120,26 +121,26 @@ int TpcClusterQA::process_event(PHCompositeNode *topNode)
   for (const auto &region : {0, 1, 2})
   {
     HistoList hist;
-    hist.crphisize_side0 = h_phisize_side0[region];
-    hist.crphisize_side1 = h_phisize_side1[region];
-    hist.czsize = h_zsize[region];
-    hist.crphierr = h_rphierror[region];
-    hist.czerr = h_zerror[region];
-    hist.cedge = h_clusedge[region];
-    hist.coverlap = h_clusoverlap[region];
+    hist.crphisize_side0 = b_phisize_side0[region];
+    hist.crphisize_side1 = b_phisize_side1[region];
+    hist.czsize = b_zsize[region];
+    hist.crphierr = b_rphierror[region];
+    hist.czerr = b_zerror[region];
+    hist.cedge = b_clusedge[region];
+    hist.coverlap = b_clusoverlap[region];
 
-    hist.cxposition_side0 = h_clusxposition_side0[region];
-    hist.cxposition_side1 = h_clusxposition_side1[region];
+    hist.cxposition_side0 = b_clusxposition_side0[region];
+    hist.cxposition_side1 = b_clusxposition_side1[region];
 
-    hist.cyposition_side0 = h_clusyposition_side0[region];
-    hist.cyposition_side1 = h_clusyposition_side1[region];
+    hist.cyposition_side0 = b_clusyposition_side0[region];
+    hist.cyposition_side1 = b_clusyposition_side1[region];
 
-    hist.czposition_side0 = h_cluszposition_side0[region];
-    hist.czposition_side1 = h_cluszposition_side1[region];
+    hist.czposition_side0 = b_cluszposition_side0[region];
+    hist.czposition_side1 = b_cluszposition_side1[region];
 
     histos.insert(std::make_pair(region, hist));
   }
-  auto fill = [](TH1 *h, float val)
+  auto fill = [](HistoFillBuffer *h, float val)
   { if (h) { h->Fill(val); 
 } };
 
@@ -183,14 +184,14 @@ int TpcClusterQA::process_event(PHCompositeNode *topNode)
         m_hitgz *= -1;
       }
       // geoLayer->identify(std::cout);
-      h_hitpositions->Fill(m_hitgx, m_hitgy);
+      b_hitpositions->Fill(m_hitgx, m_hitgy);
       if (m_side == 0)
       {
-        h_hitzpositions_side0->Fill(m_hitgz);
+        b_hitzpositions_side0->Fill(m_hitgz);
       }
       if (m_side == 1)
       {
-        h_hitzpositions_side1->Fill(m_hitgz);
+        b_hitzpositions_side1->Fill(m_hitgz);
       }
     }
   }
@@ -246,7 +247,7 @@ int TpcClusterQA::process_event(PHCompositeNode *topNode)
     }
 
     nclusperevent[sector] += numclusters;
-    h_totalclusters->Fill(hitsetkeynum, numclusters);
+    b_totalclusters->Fill(hitsetkeynum, numclusters);
     m_totalClusters += numclusters;
     hitsetkeynum++;
   }
@@ -288,78 +289,91 @@ void TpcClusterQA::createHistos()
                                          std::format("TPC (side 0) cluster #phi size region_{}", region).c_str(), 10, 0, 10);
       h_phisize_side0[region]->GetXaxis()->SetTitle("Cluster #phi_{size}");
       hm->registerHisto(h_phisize_side0[region]);
+      b_phisize_side0[region] = hm->makeFillBuffer(h_phisize_side0[region]);
     }
     {
       h_phisize_side1[region] = new TH1F(std::format("{}phisize_side1_{}", getHistoPrefix(), region).c_str(),
                                          std::format("TPC (side 1) cluster #phi size region_{}", region).c_str(), 10, 0, 10);
       h_phisize_side1[region]->GetXaxis()->SetTitle("Cluster #phi_{size}");
       hm->registerHisto(h_phisize_side1[region]);
+      b_phisize_side1[region] = hm->makeFillBuffer(h_phisize_side1[region]);
     }
     {
       h_zsize[region] = new TH1F(std::format("{}zsize_{}", getHistoPrefix(), region).c_str(),
                                  std::format("TPC cluster z size region_{}", region).c_str(), 10, 0, 10);
       h_zsize[region]->GetXaxis()->SetTitle("Cluster z_{size}");
       hm->registerHisto(h_zsize[region]);
+      b_zsize[region] = hm->makeFillBuffer(h_zsize[region]);
     }
     {
       h_rphierror[region] = new TH1F(std::format("{}rphi_error_{}", getHistoPrefix(), region).c_str(),
                                      std::format("TPC r#Delta#phi error region_{}", region).c_str(), 100, 0, 0.075);
       h_rphierror[region]->GetXaxis()->SetTitle("r#Delta#phi error [cm]");
       hm->registerHisto(h_rphierror[region]);
+      b_rphierror[region] = hm->makeFillBuffer(h_rphierror[region]);
     }
     {
       h_zerror[region] = new TH1F(std::format("{}z_error_{}", getHistoPrefix(), region).c_str(),
                                   std::format("TPC z error region_{}", region).c_str(), 100, 0, 0.18);
       h_zerror[region]->GetXaxis()->SetTitle("z error [cm]");
       hm->registerHisto(h_zerror[region]);
+      b_zerror[region] = hm->makeFillBuffer(h_zerror[region]);
     }
     {
       h_clusedge[region] = new TH1F(std::format("{}clusedge_{}", getHistoPrefix(), region).c_str(),
                                     std::format("TPC hits on edge region_{}", region).c_str(), 30, 0, 30);
       h_clusedge[region]->GetXaxis()->SetTitle("Cluster edge");
       hm->registerHisto(h_clusedge[region]);
+      b_clusedge[region] = hm->makeFillBuffer(h_clusedge[region]);
     }
     {
       h_clusoverlap[region] = new TH1F(std::format("{}clusoverlap_{}", getHistoPrefix(), region).c_str(),
                                        std::format("TPC clus overlap region_{}", region).c_str(), 30, 0, 30);
       h_clusoverlap[region]->GetXaxis()->SetTitle("Cluster overlap");
       hm->registerHisto(h_clusoverlap[region]);
+      b_clusoverlap[region] = hm->makeFillBuffer(h_clusoverlap[region]);
     }
     {
       h_clusxposition_side0[region] = new TH1F(std::format("{}clusxposition_side0_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster x position side 0 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_clusxposition_side0[region]->GetXaxis()->SetTitle("x (cm)");
       hm->registerHisto(h_clusxposition_side0[region]);
+      b_clusxposition_side0[region] = hm->makeFillBuffer(h_clusxposition_side0[region]);
     }
     {
       h_clusxposition_side1[region] = new TH1F(std::format("{}clusxposition_side1_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster x position side 1 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_clusxposition_side1[region]->GetXaxis()->SetTitle("x (cm)");
       hm->registerHisto(h_clusxposition_side1[region]);
+      b_clusxposition_side1[region] = hm->makeFillBuffer(h_clusxposition_side1[region]);
     }
     {
       h_clusyposition_side0[region] = new TH1F(std::format("{}clusyposition_side0_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster y position side 0 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_clusyposition_side0[region]->GetXaxis()->SetTitle("y (cm)");
       hm->registerHisto(h_clusyposition_side0[region]);
+      b_clusyposition_side0[region] = hm->makeFillBuffer(h_clusyposition_side0[region]);
     }
     {
       h_clusyposition_side1[region] = new TH1F(std::format("{}clusyposition_side1_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster y position side 1 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_clusyposition_side1[region]->GetXaxis()->SetTitle("y (cm)");
       hm->registerHisto(h_clusyposition_side1[region]);
+      b_clusyposition_side1[region] = hm->makeFillBuffer(h_clusyposition_side1[region]);
     }
     {
       h_cluszposition_side0[region] = new TH1F(std::format("{}cluszposition_side0_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster z position side 0 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_cluszposition_side0[region]->GetXaxis()->SetTitle("z (cm)");
       hm->registerHisto(h_cluszposition_side0[region]);
+      b_cluszposition_side0[region] = hm->makeFillBuffer(h_cluszposition_side0[region]);
     }
     {
       h_cluszposition_side1[region] = new TH1F(std::format("{}cluszposition_side1_{}", getHistoPrefix(), region).c_str(),
                                                std::format("TPC cluster z position side 1 region_{}", region).c_str(), 210 * 2, -105, 105);
       h_cluszposition_side1[region]->GetXaxis()->SetTitle("z (cm)");
       hm->registerHisto(h_cluszposition_side1[region]);
+      b_cluszposition_side1[region] = hm->makeFillBuffer(h_cluszposition_side1[region]);
     }
   }
 
@@ -369,6 +383,7 @@ void TpcClusterQA::createHistos()
     h_totalclusters->GetXaxis()->SetTitle("Hitsetkey number");
     h_totalclusters->GetYaxis()->SetTitle("Number of clusters");
     hm->registerHisto(h_totalclusters);
+    b_totalclusters = hm->makeFillBuffer(h_totalclusters);
   }
 
   {
@@ -377,18 +392,21 @@ void TpcClusterQA::createHistos()
     h_hitpositions->GetXaxis()->SetTitle("x (cm)");
     h_hitpositions->GetYaxis()->SetTitle("y (cm)");
     hm->registerHisto(h_hitpositions);
+    b_hitpositions = hm->makeFillBuffer(h_hitpositions);
   }
   {
     h_hitzpositions_side0 = new TH1F(std::string(getHistoPrefix() + "hitz_positions_side0").c_str(),
                                      "Histogram of hit z positions side=0", 105 * 4, -105, 105);
     h_hitzpositions_side0->GetXaxis()->SetTitle("z (cm)");
     hm->registerHisto(h_hitzpositions_side0);
+    b_hitzpositions_side0 = hm->makeFillBuffer(h_hitzpositions_side0);
   }
   {
     h_hitzpositions_side1 = new TH1F(std::string(getHistoPrefix() + "hitz_positions_side1").c_str(),
                                      "Histogram of hit z positions side=1", 105 * 4, -105, 105);
     h_hitzpositions_side1->GetXaxis()->SetTitle("z (cm)");
     hm->registerHisto(h_hitzpositions_side1);
+    b_hitzpositions_side1 = hm->makeFillBuffer(h_hitzpositions_side1);
   }
   return;
 }
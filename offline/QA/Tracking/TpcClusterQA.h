@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+class HistoFillBuffer;
 class PHCompositeNode;
 class TH2;
 class TH1;
@@ -60,6 +61,26 @@ class TpcClusterQA : public SubsysReco
   TH1 *h_clusyposition_side1[3] = {nullptr};
   TH1 *h_cluszposition_side0[3] = {nullptr};
   TH1 *h_cluszposition_side1[3] = {nullptr};
+
+  // buffered fills of the per hit and per cluster histograms, owned by the QA histogram manager
+  HistoFillBuffer *b_totalclusters = nullptr;
+  HistoFillBuffer *b_hitpositions = nullptr;
+  HistoFillBuffer *b_hitzpositions_side0 = nullptr;
+  HistoFillBuffer *b_hitzpositions_side1 = nullptr;
+
+  HistoFillBuffer *b_phisize_side0[3] = {nullptr};
+  HistoFillBuffer *b_phisize_side1[3] = {nullptr};
+  HistoFillBuffer *b_zsize[3] = {nullptr};
+  HistoFillBuffer *b_rphierror[3] = {nullptr};
+  HistoFillBuffer *b_zerror[3] = {nullptr};
+  HistoFillBuffer *b_clusedge[3] = {nullptr};
+  HistoFillBuffer *b_clusoverlap[3] = {nullptr};
+  HistoFillBuffer *b_clusxposition_side0[3] = {nullptr};
+  HistoFillBuffer *b_clusxposition_side1[3] = {nullptr};
+  HistoFillBuffer *b_clusyposition_side0[3] = {nullptr};
+  HistoFillBuffer *b_clusyposition_side1[3] = {nullptr};
+  HistoFillBuffer *b_cluszposition_side0[3] = {nullptr};
+  HistoFillBuffer *b_cluszposition_side1[3] = {nullptr};
 };
 
 #endif  // QA_TRACKING_TPCCLUSTERQA_H
@@ -0,0 +1,83 @@
+#ifndef CDBOBJECTS_CDBCOLUMN_H
+#define CDBOBJECTS_CDBCOLUMN_H
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+//! read-only view of one per channel field of a CDBTTree
+/*!
+ * values are stored densely in increasing channel order, channels without
+ * this field hold the same "missing" value the CDBTTree Get*Value methods
+ * return (NaN for float/double, INT_MIN for int, UINT64_MAX for uint64).
+ * The view points into its CDBTTree and is valid as long as the CDBTTree lives.
+ * It converts to std::span<const T> over the values, for channels numbered
+ * 0..size()-1 (check first_channel() and contiguous()) the span is indexed by channel.
+ */
+template <class T>
+class CDBColumn
+{
+ public:
+  CDBColumn() = default;
+  CDBColumn(const std::vector<int> *channels, const std::vector<T> *values, T missing)
+    : m_channels(channels)
+    , m_values(values)
+    , m_missing(missing)
+  {
+    // channels are sorted and unique, first + size - 1 == last means no gaps
+    if (m_channels && !m_channels->empty())
+    {
+      m_contiguous = (static_cast<long>(m_channels->back()) - m_channels->front() + 1 == static_cast<long>(m_channels->size()));
+    }
+  }
+
+  //! false if the field does not exist, operator() then returns the missing value for all channels
+  bool valid() const { return m_values != nullptr; }
+
+  //! number of channels
+  std::size_t size() const { return m_values ? m_values->size() : 0; }
+
+  //! values, in channel order
+  std::span<const T> values() const { return m_values ? std::span<const T>(*m_values) : std::span<const T>(); }
+  operator std::span<const T>() const { return values(); }
+
+  //! channel numbers of the values
+  std::span<const int> channels() const { return m_channels ? std::span<const int>(*m_channels) : std::span<const int>(); }
+
+  //! true if the channels have no gaps, values()[channel - first_channel()] is then the value of channel
+  bool contiguous() const { return m_contiguous; }
+  int first_channel() const { return (m_channels && !m_channels->empty()) ? m_channels->front() : 0; }
+
+  //! value of given channel, same as CDBTTree::Get*Value but without map and string lookups
+  T operator()(int channel) const
+  {
+    if (!m_values || m_values->empty())
+    {
+      return m_missing;
+    }
+    if (m_contiguous)
+    {
+      const long index = static_cast<long>(channel) - m_channels->front();
+      if (index < 0 || index >= static_cast<long>(m_values->size()))
+      {
+        return m_missing;
+      }
+      return (*m_values)[index];
+    }
+    auto iter = std::lower_bound(m_channels->begin(), m_channels->end(), channel);
+    if (iter == m_channels->end() || *iter != channel)
+    {
+      return m_missing;
+    }
+    return (*m_values)[iter - m_channels->begin()];
+  }
+
+ private:
+  const std::vector<int> *m_channels{nullptr};
+  const std::vector<T> *m_values{nullptr};
+  T m_missing{};
+  bool m_contiguous{false};
+};
+
+#endif
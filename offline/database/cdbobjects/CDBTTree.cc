@@ -12,6 +12,7 @@
 #include <TSystem.h>
 #include <TTree.h>
 
+#include <algorithm>  // for stable_sort
 #include <climits>
 #include <cmath>    // for NAN, isfinite
 #include <cstdint>  // for uint64_t
@@ -19,6 +20,7 @@
 #include <limits>   // for numeric_limits, numeric_limits<>::max_digits10
 #include <set>      // for set
 #include <utility>  // for pair, make_pair
+#include <vector>
 
 int CDBTTree::verbosity = 0;  // the verbosity can be set by the static SetVerbosity(int v) method
 
@@ -883,3 +885,135 @@ uint64_t CDBTTree::GetUInt64Value(int channel, const std::string &name, int verb
   }
   return calibiter->second;
 }
+
+CDBColumn<float> CDBTTree::GetFloatColumn(const std::string &name, int verbose)
+{
+  return GetColumn("F" + name, "Float_t", std::numeric_limits<float>::quiet_NaN(), m_FloatEntryMap, m_FloatColumnMap, verbose);
+}
+
+CDBColumn<double> CDBTTree::GetDoubleColumn(const std::string &name, int verbose)
+{
+  return GetColumn("D" + name, "Double_t", std::numeric_limits<double>::quiet_NaN(), m_DoubleEntryMap, m_DoubleColumnMap, verbose);
+}
+
+CDBColumn<int> CDBTTree::GetIntColumn(const std::string &name, int verbose)
+{
+  return GetColumn("I" + name, "Int_t", std::numeric_limits<int>::min(), m_IntEntryMap, m_IntColumnMap, verbose);
+}
+
+CDBColumn<uint64_t> CDBTTree::GetUInt64Column(const std::string &name, int verbose)
+{
+  return GetColumn("g" + name, "ULong_t", std::numeric_limits<uint64_t>::max(), m_UInt64EntryMap, m_UInt64ColumnMap, verbose);
+}
+
+template <class T>
+CDBColumn<T> CDBTTree::GetColumn(const std::string &fieldname, const std::string &datatype, T missing,
+                                 const std::map<int, std::map<std::string, T>> &entrymap,
+                                 std::map<std::string, ColumnData<T>> &columnmap, int verbose)
+{
+  auto columniter = columnmap.find(fieldname);
+  if (columniter == columnmap.end())
+  {
+    ColumnData<T> column;
+    bool found = false;
+    if (fieldname == "IID")
+    {
+      // reserved for the channel number
+    }
+    else if (!entrymap.empty())
+    {
+      // calibrations are already in memory (loaded or set)
+      column.channels.reserve(entrymap.size());
+      column.values.reserve(entrymap.size());
+      for (const auto &entry : entrymap)
+      {
+        column.channels.push_back(entry.first);
+        auto calibiter = entry.second.find(fieldname);
+        if (calibiter != entry.second.end())
+        {
+          column.values.push_back(calibiter->second);
+          found = true;
+        }
+        else
+        {
+          column.values.push_back(missing);
+        }
+      }
+    }
+    else
+    {
+      found = ReadColumn(fieldname, datatype, missing, column);
+    }
+    if (!found)
+    {
+      if (verbosity > 0 || verbose > 0)
+      {
+        std::cout << PHWHERE << " Could not find " << fieldname.substr(1) << " among " << datatype << " calibrations" << std::endl;
+      }
+      return CDBColumn<T>(nullptr, nullptr, missing);
+    }
+    columniter = columnmap.insert(std::make_pair(fieldname, std::move(column))).first;
+  }
+  return CDBColumn<T>(&columniter->second.channels, &columniter->second.values, missing);
+}
+
+template <class T>
+bool CDBTTree::ReadColumn(const std::string &fieldname, const std::string &datatype, T missing, ColumnData<T> &column)
+{
+  if (m_Filename.empty())
+  {
+    return false;
+  }
+  std::string currdir = gDirectory->GetPath();
+
+  TFile *f = TFile::Open(m_Filename.c_str());
+  if (!f)
+  {
+    std::cout << PHWHERE << "TFile::Open(" << m_Filename << ") failed" << std::endl;
+    gSystem->Exit(1);
+    exit(1);
+  }
+  bool found = false;
+  TTree *ttree = nullptr;
+  f->GetObject(m_TTreeName[MultipleEntries].c_str(), ttree);
+  if (ttree != nullptr)
+  {
+    TBranch *idbranch = ttree->GetBranch("IID");
+    TBranch *branch = ttree->GetBranch(fieldname.c_str());
+    TLeaf *leaf = (branch != nullptr) ? branch->GetLeaf(fieldname.c_str()) : nullptr;
+    if (idbranch != nullptr && leaf != nullptr && datatype == leaf->GetTypeName())
+    {
+      // only these two branches are read
+      int id = std::numeric_limits<int>::min();
+      T value = missing;
+      idbranch->SetAddress(&id);
+      branch->SetAddress(&value);
+      std::vector<std::pair<int, T>> entries;
+      entries.reserve(ttree->GetEntries());
+      for (Long64_t entry = 0; entry < ttree->GetEntries(); ++entry)
+      {
+        idbranch->GetEntry(entry);
+        branch->GetEntry(entry);
+        entries.emplace_back(id, value);
+      }
+      // ids are written sorted, this is just for safety. Like in LoadCalibrations
+      // the first entry of a duplicated id wins
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const std::pair<int, T> &lhs, const std::pair<int, T> &rhs)
+                       { return lhs.first < rhs.first; });
+      for (const auto &entry : entries)
+      {
+        if (column.channels.empty() || column.channels.back() != entry.first)
+        {
+          column.channels.push_back(entry.first);
+          column.values.push_back(entry.second);
+        }
+      }
+      found = true;
+    }
+  }
+  f->Close();
+  delete f;
+  gROOT->cd(currdir.c_str());  // restore previous directory
+  return found;
+}
@@ -1,9 +1,12 @@
 #ifndef CDBOBJECTS_CDBTTREE_H
 #define CDBOBJECTS_CDBTTREE_H
 
+#include "CDBColumn.h"
+
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 class TTree;
 
@@ -39,6 +42,16 @@ class CDBTTree
   uint64_t GetSingleUInt64Value(const std::string &name, int verbose = 0);
   uint64_t GetUInt64Value(int channel, const std::string &name, int verbose = 0);
 
+  //! per channel field as dense column, fetch it once instead of calling Get*Value per channel
+  //! only this field is read from the file if the calibrations were not loaded yet
+  //! check valid(), the column is invalid if the field does not exist
+  //! the column is built on first request, later Set*Value calls are not reflected
+  //! the handle converts to std::span<const T> over the values in channel order
+  CDBColumn<float> GetFloatColumn(const std::string &name, int verbose = 0);
+  CDBColumn<double> GetDoubleColumn(const std::string &name, int verbose = 0);
+  CDBColumn<int> GetIntColumn(const std::string &name, int verbose = 0);
+  CDBColumn<uint64_t> GetUInt64Column(const std::string &name, int verbose = 0);
+
   const auto &GetFloatEntryMap() const { return m_FloatEntryMap; }
   const auto &GetDoubleEntryMap() const { return m_DoubleEntryMap; }
   const auto &GetIntEntryMap() const { return m_IntEntryMap; }
@@ -55,6 +68,22 @@ class CDBTTree
     SingleEntries = 0,
     MultipleEntries = 1
   };
+  template <class T>
+  struct ColumnData
+  {
+    std::vector<int> channels;
+    std::vector<T> values;
+  };
+
+  template <class T>
+  CDBColumn<T> GetColumn(const std::string &fieldname, const std::string &datatype, T missing,
+                         const std::map<int, std::map<std::string, T>> &entrymap,
+                         std::map<std::string, ColumnData<T>> &columnmap, int verbose);
+
+  //! read IID and a single field from the Multiple TTree
+  template <class T>
+  bool ReadColumn(const std::string &fieldname, const std::string &datatype, T missing, ColumnData<T> &column);
+
   const std::string m_TTreeName[2] = {"Single", "Multiple"};
   TTree *m_TTree[2] = {nullptr};
   static int verbosity;
@@ -69,6 +98,12 @@ class CDBTTree
   std::map<std::string, int> m_SingleIntEntryMap;
   std::map<int, std::map<std::string, uint64_t>> m_UInt64EntryMap;
   std::map<std::string, uint64_t> m_SingleUInt64EntryMap;
+
+  // columns handed out by Get*Column, filled on first request
+  std::map<std::string, ColumnData<float>> m_FloatColumnMap;
+  std::map<std::string, ColumnData<double>> m_DoubleColumnMap;
+  std::map<std::string, ColumnData<int>> m_IntColumnMap;
+  std::map<std::string, ColumnData<uint64_t>> m_UInt64ColumnMap;
 };
 
 #endif
@@ -2,6 +2,8 @@
 
 #include <sphenixnpc/SphenixClient.h>
 
+#include <nlohmann/json.hpp>
+
 #include <ffaobjects/CdbUrlSave.h>
 #include <ffaobjects/CdbUrlSavev1.h>
 
@@ -20,11 +22,48 @@
 
 #include <TSystem.h>
 
-#include <cstdint>   // for uint64_t
+#include <sys/stat.h>  // for stat
+#include <unistd.h>    // for getpid
+
+#include <cstdint>     // for uint64_t
+#include <cstdio>      // for snprintf
+#include <filesystem>
+#include <fstream>
 #include <iostream>  // for operator<<, basic_ostream, endl
+#include <sstream>
 #include <utility>   // for pair
 #include <vector>    // for vector
 
+namespace
+{
+  // 64 bit FNV-1a hash, names the files of the node cache
+  constexpr uint64_t fnv_offset = 14695981039346656037ULL;
+  constexpr uint64_t fnv_prime = 1099511628211ULL;
+
+  uint64_t fnv1a(const char *data, size_t size, uint64_t hash = fnv_offset)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= fnv_prime;
+    }
+    return hash;
+  }
+
+  std::string to_hex(uint64_t value)
+  {
+    char buffer[17];
+    snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(value));
+    return buffer;
+  }
+
+  // unique name of temporary files, which are renamed once complete so other jobs never see partial files
+  std::string tmpname(const std::string &filename)
+  {
+    return filename + ".tmp" + std::to_string(getpid());
+  }
+}  // namespace
+
 CDBInterface *CDBInterface::__instance{nullptr};
 
 CDBInterface *CDBInterface::instance()
@@ -56,6 +95,10 @@ CDBInterface::~CDBInterface()
 int CDBInterface::End(PHCompositeNode *topNode)
 {
   int iret = UpdateRunNode(topNode);PHNodeIterator iter(topNode);
+  if (Verbosity() > 0)
+  {
+    PrintCacheStats();
+  }
   return iret;
 }
 
@@ -110,16 +153,34 @@ int CDBInterface::UpdateRunNode(PHCompositeNode *topNode)
 }
 
 //____________________________________________________________________________..
-void CDBInterface::Print(const std::string & /* what */) const
+void CDBInterface::Print(const std::string &what) const
 {
-  for (const auto &iter : m_UrlVector)
+  if (what == "ALL" || what == "URL")
+  {
+    for (const auto &iter : m_UrlVector)
+    {
+      std::cout << "domain: " << std::get<0>(iter)
+                << ", url: " << std::get<1>(iter)
+                << ", timestamp: " << std::get<2>(iter) << std::endl;
+    }
+  }
+  if (what == "ALL" || what == "CACHE")
   {
-    std::cout << "domain: " << std::get<0>(iter)
-              << ", url: " << std::get<1>(iter)
-              << ", timestamp: " << std::get<2>(iter) << std::endl;
+    PrintCacheStats();
   }
 }
 
+void CDBInterface::PrintCacheStats() const
+{
+  std::cout << "CDBInterface url lookups: " << m_MemoryHits << " memory hits, "
+            << m_NodeCacheHits << " node cache hits, "
+            << m_DBQueries << " database queries ("
+            << m_DBTimer.get_accumulated_time() << " ms)" << std::endl;
+  std::cout << "CDBInterface payload copies: " << m_PayloadCopyHits << " hits, "
+            << m_PayloadCopies << " new copies, node cache time "
+            << m_NodeCacheTimer.get_accumulated_time() << " ms" << std::endl;
+}
+
 std::string CDBInterface::getUrl(const std::string &domain, const std::string &filename)
 {
   if (disable)
@@ -140,10 +201,6 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
     std::cout << "rc->set_uint64Flag(\"TIMESTAMP\",<64 bit timestamp>)" << std::endl;
     gSystem->Exit(1);
   }
-  if (cdbclient == nullptr)
-  {
-    cdbclient = new SphenixClient(rc->get_StringFlag("CDB_GLOBALTAG"));
-  }
   uint64_t timestamp = rc->get_uint64Flag("TIMESTAMP");
   if (Verbosity() > 0)
   {
@@ -151,14 +208,25 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
               << ", domain: " << domain_noconst
               << ", timestamp: " << timestamp;
   }
-  std::string return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+  // all domains are looked up at once, subsequent calls for this timestamp do not go to the database
+  const UrlDict *urldict = getUrlDict(rc->get_StringFlag("CDB_GLOBALTAG"), timestamp);
+  auto calibration = [urldict](const std::string &pl_type)
+  {
+    if (urldict == nullptr)
+    {
+      return std::string();
+    }
+    auto iter = urldict->find(pl_type);
+    return (iter == urldict->end()) ? std::string() : iter->second;
+  };
+  std::string return_url = calibration(domain_noconst);
   if (return_url.empty())
   {
     if (!disable_default)
     {
       std::string domain_copy = domain_noconst;
       domain_noconst = domain_noconst + "_default";
-      return_url = cdbclient->getCalibration(domain_noconst, timestamp);
+      return_url = calibration(domain_noconst);
       if (return_url.empty())
       {
         if (Verbosity() > 0)
@@ -193,6 +261,239 @@ std::string CDBInterface::getUrl(const std::string &domain, const std::string &f
       std::cout << PHWHERE << "not adding again " << domain_noconst << ", url: " << return_url
 		<< ", time stamp: " << timestamp << std::endl;
     }
+    // the run node keeps the database url, the caller gets the node local copy
+    if (return_url != filename)
+    {
+      return_url = localCopy(return_url);
+    }
   }
   return return_url;
 }
+
+void CDBInterface::Prefetch()
+{
+  if (disable)
+  {
+    return;
+  }
+  recoConsts *rc = recoConsts::instance();
+  if (!rc->FlagExist("CDB_GLOBALTAG") || !rc->FlagExist("TIMESTAMP"))
+  {
+    std::cout << PHWHERE << "CDB_GLOBALTAG and TIMESTAMP flags need to be set for prefetching" << std::endl;
+    return;
+  }
+  const UrlDict *urldict = getUrlDict(rc->get_StringFlag("CDB_GLOBALTAG"), rc->get_uint64Flag("TIMESTAMP"));
+  if (Verbosity() > 0 && urldict != nullptr)
+  {
+    std::cout << "CDBInterface prefetched " << urldict->size() << " payload urls" << std::endl;
+  }
+}
+
+const CDBInterface::UrlDict *CDBInterface::getUrlDict(const std::string &globaltag, uint64_t timestamp)
+{
+  auto key = std::make_pair(globaltag, timestamp);
+  auto iter = m_UrlDictCache.find(key);
+  if (iter != m_UrlDictCache.end())
+  {
+    m_MemoryHits++;
+    return &iter->second;
+  }
+  recoConsts *rc = recoConsts::instance();
+  const std::string dictfile = urlDictFile(globaltag, timestamp);
+  UrlDict urldict;
+  if (!dictfile.empty())
+  {
+    m_NodeCacheTimer.restart();
+    bool found = readUrlDict(dictfile, urldict);
+    m_NodeCacheTimer.stop();
+    if (found)
+    {
+      m_NodeCacheHits++;
+      return &m_UrlDictCache.insert(std::make_pair(key, urldict)).first->second;
+    }
+  }
+  if (rc->FlagExist("CDB_OFFLINE") && rc->get_IntFlag("CDB_OFFLINE") != 0)
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << PHWHERE << " offline mode, no cached urls for global tag " << globaltag
+                << ", timestamp " << timestamp << std::endl;
+    }
+    return nullptr;
+  }
+  if (cdbclient == nullptr)
+  {
+    cdbclient = new SphenixClient(globaltag);
+  }
+  // same selection as SphenixClient::getUrl, for all payload types at once
+  m_DBTimer.restart();
+  nlohmann::json resp = cdbclient->getPayloadIOVs(timestamp);
+  m_DBTimer.stop();
+  m_DBQueries++;
+  if (resp["code"] != 0)
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << resp << std::endl;
+    }
+    // not cached, the next call tries again
+    return nullptr;
+  }
+  for (auto &payload_iov : resp["msg"].items())
+  {
+    if (payload_iov.value()["minor_iov_end"] <= static_cast<long long>(timestamp))
+    {
+      continue;
+    }
+    urldict.insert(std::make_pair(payload_iov.key(), payload_iov.value()["payload_url"].get<std::string>()));
+  }
+  if (!dictfile.empty())
+  {
+    m_NodeCacheTimer.restart();
+    writeUrlDict(dictfile, urldict);
+    m_NodeCacheTimer.stop();
+  }
+  return &m_UrlDictCache.insert(std::make_pair(key, urldict)).first->second;
+}
+
+std::string CDBInterface::urlDictFile(const std::string &globaltag, uint64_t timestamp) const
+{
+  recoConsts *rc = recoConsts::instance();
+  if (!rc->FlagExist("CDB_CACHE_DIR"))
+  {
+    return "";
+  }
+  return rc->get_StringFlag("CDB_CACHE_DIR") + "/" + globaltag + "/" + std::to_string(timestamp) + ".urls";
+}
+
+bool CDBInterface::readUrlDict(const std::string &filename, UrlDict &dict)
+{
+  std::ifstream infile(filename);
+  if (!infile.is_open())
+  {
+    return false;
+  }
+  std::string line;
+  while (std::getline(infile, line))
+  {
+    std::istringstream linestream(line);
+    std::string domain;
+    std::string url;
+    if (linestream >> domain >> url)
+    {
+      dict.insert(std::make_pair(domain, url));
+    }
+  }
+  return true;
+}
+
+bool CDBInterface::writeUrlDict(const std::string &filename, const UrlDict &dict)
+{
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(filename).parent_path(), ec);
+  const std::string tmpfile = tmpname(filename);
+  {
+    std::ofstream outfile(tmpfile);
+    for (const auto &iter : dict)
+    {
+      outfile << iter.first << " " << iter.second << std::endl;
+    }
+    if (!outfile)
+    {
+      std::filesystem::remove(tmpfile, ec);
+      return false;
+    }
+  }
+  std::filesystem::rename(tmpfile, filename, ec);
+  if (ec)
+  {
+    std::filesystem::remove(tmpfile, ec);
+    return false;
+  }
+  return true;
+}
+
+std::string CDBInterface::localCopy(const std::string &url)
+{
+  recoConsts *rc = recoConsts::instance();
+  struct stat st
+  {
+  };
+  // only local (shared) file system paths are copied
+  if (!rc->FlagExist("CDB_CACHE_DIR") || url.empty() || url[0] != '/' || stat(url.c_str(), &st) != 0)
+  {
+    return url;
+  }
+  m_NodeCacheTimer.restart();
+  const std::string payloaddir = rc->get_StringFlag("CDB_CACHE_DIR") + "/payloads";
+  const std::string stamp = std::to_string(st.st_size) + " " + std::to_string(st.st_mtime);
+  // the link file maps the url to the content addressed copy, valid as long as size and modification time match
+  const std::string linkfile = payloaddir + "/" + to_hex(fnv1a(url.data(), url.size())) + ".link";
+  {
+    std::ifstream infile(linkfile);
+    std::string linkstamp;
+    std::string copyname;
+    if (std::getline(infile, linkstamp) && std::getline(infile, copyname) && linkstamp == stamp)
+    {
+      const std::string copy = payloaddir + "/" + copyname;
+      std::error_code ec;
+      if (std::filesystem::file_size(copy, ec) == static_cast<uintmax_t>(st.st_size) && !ec)
+      {
+        m_PayloadCopyHits++;
+        m_NodeCacheTimer.stop();
+        return copy;
+      }
+    }
+  }
+  std::error_code ec;
+  std::filesystem::create_directories(payloaddir, ec);
+  // copy and hash in one pass, the copy is named after the content hash
+  const std::string tmpfile = tmpname(payloaddir + "/payload");
+  uint64_t hash = fnv_offset;
+  {
+    std::ifstream infile(url, std::ios::binary);
+    std::ofstream outfile(tmpfile, std::ios::binary | std::ios::trunc);
+    std::vector<char> buffer(1U << 20U);
+    while (infile && outfile)
+    {
+      infile.read(buffer.data(), buffer.size());
+      hash = fnv1a(buffer.data(), infile.gcount(), hash);
+      outfile.write(buffer.data(), infile.gcount());
+    }
+    if (!infile.eof() || !outfile)
+    {
+      outfile.close();
+      std::filesystem::remove(tmpfile, ec);
+      m_NodeCacheTimer.stop();
+      return url;
+    }
+  }
+  // keep the original file name at the end, some consumers check the extension
+  const std::string copyname = to_hex(hash) + "_" + std::filesystem::path(url).filename().string();
+  const std::string copy = payloaddir + "/" + copyname;
+  if (std::filesystem::exists(copy, ec))
+  {
+    // same content already copied for another url or by another job
+    std::filesystem::remove(tmpfile, ec);
+  }
+  else
+  {
+    std::filesystem::rename(tmpfile, copy, ec);
+    if (ec)
+    {
+      std::filesystem::remove(tmpfile, ec);
+      m_NodeCacheTimer.stop();
+      return url;
+    }
+  }
+  const std::string tmplink = tmpname(linkfile);
+  {
+    std::ofstream outfile(tmplink);
+    outfile << stamp << std::endl
+            << copyname << std::endl;
+  }
+  std::filesystem::rename(tmplink, linkfile, ec);
+  m_PayloadCopies++;
+  m_NodeCacheTimer.stop();
+  return copy;
+}
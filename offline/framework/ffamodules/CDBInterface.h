@@ -5,10 +5,14 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <phool/PHTimer.h>
+
 #include <cstdint>  // for uint64_t
+#include <map>
 #include <set>
 #include <string>
 #include <tuple>  // for tuple
+#include <utility>  // for pair
 
 class SphenixClient;
 
@@ -34,14 +38,46 @@ class CDBInterface : public SubsysReco
 
   std::string getUrl(const std::string &domain, const std::string &filename = "");
 
+  //! look up the urls of all domains for the current TIMESTAMP in one query
+  //! getUrl does this on its first call for a timestamp, call it at startup to do it up front
+  void Prefetch();
+
  private:
+  //! domain -> payload url of all payloads valid at one timestamp
+  using UrlDict = std::map<std::string, std::string>;
+
   CDBInterface(const std::string &name = "CDBInterface");
 
+  //! url dictionary for global tag and timestamp, from memory, the node cache or the database
+  const UrlDict *getUrlDict(const std::string &globaltag, uint64_t timestamp);
+
+  //! node cache file of the url dictionary
+  std::string urlDictFile(const std::string &globaltag, uint64_t timestamp) const;
+  static bool readUrlDict(const std::string &filename, UrlDict &dict);
+  static bool writeUrlDict(const std::string &filename, const UrlDict &dict);
+
+  //! content addressed copy of a payload file in the node cache, url if it cannot be copied
+  std::string localCopy(const std::string &url);
+
+  void PrintCacheStats() const;
+
   static CDBInterface *__instance;
   SphenixClient *cdbclient{nullptr};
   bool disable{false};
   bool disable_default{false};
   std::set<std::tuple<std::string, std::string, uint64_t>> m_UrlVector;
+
+  // url lookup cache, see getUrlDict
+  // CDB_CACHE_DIR (string flag): node local cache directory for url dictionaries and payload copies
+  // CDB_OFFLINE (int flag): never contact the database, use only the node cache
+  std::map<std::pair<std::string, uint64_t>, UrlDict> m_UrlDictCache;
+  unsigned int m_MemoryHits{0};
+  unsigned int m_NodeCacheHits{0};
+  unsigned int m_DBQueries{0};
+  unsigned int m_PayloadCopyHits{0};
+  unsigned int m_PayloadCopies{0};
+  PHTimer m_DBTimer{"CDB queries"};
+  PHTimer m_NodeCacheTimer{"CDB node cache"};
 };
 
 #endif  // FFAMODULES_CDBINTERFACE_H
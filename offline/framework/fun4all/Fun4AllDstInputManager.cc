@@ -22,6 +22,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <iostream>  // for operator<<, basic_ostream, endl
@@ -38,6 +39,11 @@ Fun4AllDstInputManager::Fun4AllDstInputManager(const std::string &name, const st
 
 Fun4AllDstInputManager::~Fun4AllDstInputManager()
 {
+  if (m_LazyRead)
+  {
+    // includes the file which is still open
+    PrintLazyReadStatistics();
+  }
   delete m_IManager;
   delete m_RunNodeSum;
   return;
@@ -125,6 +131,7 @@ int Fun4AllDstInputManager::fileopen(const std::string &filenam)
   // now open the dst node
   dstNode = se->getNode(InputNode(), TopNodeName());
   m_IManager = new PHNodeIOManager(fullfilename, PHReadOnly);
+  m_IManager->LazyRead(m_LazyRead);
   if (m_IManager->isFunctional())
   {
     IsOpen(1);
@@ -219,6 +226,7 @@ int Fun4AllDstInputManager::fileclose()
     std::cout << Name() << ": fileclose: No Input file open" << std::endl;
     return -1;
   }
+  CollectLazyReadStatistics();
   delete m_IManager;
   m_IManager = nullptr;
   IsOpen(0);
@@ -622,10 +630,62 @@ void Fun4AllDstInputManager::Print(const std::string &what) const
     std::cout << "PHNodeIOManager print in Fun4AllDstInputManager " << Name() << ":" << std::endl;
     m_IManager->print();
   }
+  if ((what == "ALL" || what == "LAZYREAD") && m_LazyRead)
+  {
+    PrintLazyReadStatistics();
+  }
   Fun4AllInputManager::Print(what);
   return;
 }
 
+void Fun4AllDstInputManager::CollectLazyReadStatistics()
+{
+  if (!m_IManager || !m_IManager->LazyRead())
+  {
+    return;
+  }
+  m_LazyEvents += m_IManager->LazyEvents();
+  m_IManager->LazyReadStatistics(m_LazyBranchReads);
+}
+
+void Fun4AllDstInputManager::PrintLazyReadStatistics() const
+{
+  // includes the currently open file
+  uint64_t nevents = m_LazyEvents;
+  std::map<std::string, uint64_t> nreads = m_LazyBranchReads;
+  if (m_IManager && m_IManager->LazyRead())
+  {
+    nevents += m_IManager->LazyEvents();
+    m_IManager->LazyReadStatistics(nreads);
+  }
+  std::cout << "--------------------------------------" << std::endl
+            << std::endl;
+  std::cout << "Lazy read branch statistics of Fun4AllDstInputManager " << Name()
+            << " for " << nevents << " events:" << std::endl;
+  std::vector<std::string> unused;
+  for (const auto &iter : nreads)
+  {
+    std::cout << iter.first << " read in " << iter.second << " events";
+    if (nevents > 0)
+    {
+      std::cout << " (" << 100. * static_cast<double>(iter.second) / static_cast<double>(nevents) << "%)";
+    }
+    std::cout << std::endl;
+    if (iter.second == 0)
+    {
+      unused.push_back(iter.first);
+    }
+  }
+  if (!unused.empty())
+  {
+    std::cout << "Branches which were never read, they can be switched off with BranchSelect():" << std::endl;
+    for (const auto &iter : unused)
+    {
+      std::cout << "  " << iter << std::endl;
+    }
+  }
+}
+
 int Fun4AllDstInputManager::PushBackEvents(const int i)
 {
   if (m_IManager)
@@ -640,6 +700,57 @@ int Fun4AllDstInputManager::PushBackEvents(const int i)
   return -1;
 }
 
+int Fun4AllDstInputManager::ReopenAfterFork()
+{
+  if (!m_IManager)
+  {
+    return 0;
+  }
+  // the run node was read by the main process already, only the event
+  // tree is opened again and set to the next event
+  const size_t EventOnDst = m_IManager->getEventNumber();
+  CollectLazyReadStatistics();
+  delete m_IManager;
+  m_IManager = new PHNodeIOManager(fullfilename, PHReadOnly);
+  m_IManager->LazyRead(m_LazyRead);
+  if (!m_IManager->isFunctional())
+  {
+    std::cout << PHWHERE << ": " << Name() << " Could not reopen file "
+              << fullfilename << std::endl;
+    delete m_IManager;
+    m_IManager = nullptr;
+    IsOpen(0);
+    return -1;
+  }
+  setBranches();
+  if (ReadCacheDisabled())
+  {
+    m_IManager->DisableReadCache();
+  }
+  m_IManager->setEventNumber(EventOnDst);
+  return 0;
+}
+
+int Fun4AllDstInputManager::SkipInFile(const int nevt)
+{
+  // events rejected by local SubsysRecos do not count, they have to be read
+  if (!m_IManager || HasRejectModules() || nevt <= 0)
+  {
+    return 0;
+  }
+  const size_t EventOnDst = m_IManager->getEventNumber();
+  const size_t EventsInFile = m_IManager->GetEventsInFile();
+  if (EventOnDst >= EventsInFile)
+  {
+    return 0;
+  }
+  const int nskip = static_cast<int>(std::min(EventsInFile - EventOnDst, static_cast<size_t>(nevt)));
+  m_IManager->setEventNumber(EventOnDst + nskip);
+  events_total += nskip;
+  events_thisfile += nskip;
+  return nskip;
+}
+
 int Fun4AllDstInputManager::HasSyncObject() const
 {
   if (m_HaveSyncObject)
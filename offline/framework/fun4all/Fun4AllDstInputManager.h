@@ -7,6 +7,7 @@
 
 #include <phool/PHNodeIOManager.h>
 
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -27,13 +28,22 @@ class Fun4AllDstInputManager : public Fun4AllInputManager
   int BranchSelect(const std::string &branch, const int iflag) override;
   int setBranches() override;
   void CacheSize(uint64_t size) { m_IManager->CacheSize(size); }
+  //! read objects only when they are accessed (see PHNodeIOManager::LazyRead),
+  //! has to be set before the first file is opened. The branch access
+  //! statistics are printed at the end, Print("LAZYREAD") prints them any time
+  void LazyRead(const bool b) { m_LazyRead = b; }
   virtual int setSyncBranches(PHNodeIOManager *iman);
   void Print(const std::string &what = "ALL") const override;
   int PushBackEvents(const int i) override;
   int HasSyncObject() const override;
+  bool CanReopenAfterFork() const override { return true; }
+  int ReopenAfterFork() override;
+  int SkipInFile(const int nevt) override;
 
  protected:
   int ReadNextEventSyncObject();
+  void CollectLazyReadStatistics();
+  void PrintLazyReadStatistics() const;
   void ReadRunTTree(const int i) { m_ReadRunTTree = i; }
   void IManager(PHNodeIOManager *iman) { m_IManager = iman; }
   PHNodeIOManager *IManager() { return m_IManager; }
@@ -58,6 +68,9 @@ class Fun4AllDstInputManager : public Fun4AllInputManager
   int events_thisfile{0};
   int events_skipped_during_sync{0};
   int m_HaveSyncObject{0};
+  bool m_LazyRead{false};
+  uint64_t m_LazyEvents{0};
+  std::map<std::string, uint64_t> m_LazyBranchReads;
   std::map<const std::string, int> branchread;
   std::string syncbranchname;
   std::string RunNode{"RUN"};
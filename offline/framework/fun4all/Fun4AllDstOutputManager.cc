@@ -9,6 +9,7 @@
 #include <phool/phool.h>  // for PHWHERE, PHReadOnly, PHRunTree
 #include <phool/recoConsts.h>
 
+#include <TROOT.h>
 #include <TSystem.h>
 
 #include <cstdlib>
@@ -92,6 +93,15 @@ void Fun4AllDstOutputManager::Print(const std::string &what) const
       }
     }
   }
+  if (what == "ALL" || what == "TIMING")
+  {
+    std::cout << Name() << ": time spent writing events: " << WriteTime() << " ms";
+    if (m_CompressionThreads > 0)
+    {
+      std::cout << ", parallel compression with " << m_CompressionThreads << " threads";
+    }
+    std::cout << std::endl;
+  }
   // base class print method
   Fun4AllOutputManager::Print(what);
 
@@ -171,7 +181,9 @@ int Fun4AllDstOutputManager::Write(PHCompositeNode *startNode)
       }
     }
   }
+  m_WriteTimer.restart();
   dstOut->write(startNode);
+  m_WriteTimer.stop();
   // to save some cpu cycles we only make it globally transient if
   // all nodes have been written (savenodes set is empty)
   // else we only make the nodes transient which we have written (all
@@ -337,6 +349,16 @@ int Fun4AllDstOutputManager::outfile_open_first_write()
     m_CurrentSegment++;
   }
   m_UsedOutFileName = OutFileName() + std::string("?reproducible=") + std::string(p.filename());
+  // implicit MT has to be on before the TTree is created
+  if (m_CompressionThreads > 0 && !ROOT::IsImplicitMTEnabled())
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << PHWHERE << Name() << ": enabling ROOT implicit MT with "
+                << m_CompressionThreads << " threads" << std::endl;
+    }
+    ROOT::EnableImplicitMT(m_CompressionThreads);
+  }
   dstOut = new PHNodeIOManager(UsedOutFileName(), PHWrite);
   if (SplitLevel() != std::numeric_limits<int>::min())
   {
@@ -355,6 +377,10 @@ int Fun4AllDstOutputManager::outfile_open_first_write()
   }
 
   dstOut->SetCompressionSetting(m_CompressionSetting);
+  if (m_AutoFlushEvents > 0)
+  {
+    dstOut->AutoFlush(m_AutoFlushEvents);
+  }
   return 0;
 }
 
@@ -5,6 +5,8 @@
 
 #include "Fun4AllOutputManager.h"
 
+#include <phool/PHTimer.h>
+
 #include <set>
 #include <string>
 
@@ -36,13 +38,23 @@ class Fun4AllDstOutputManager : public Fun4AllOutputManager
   const std::string &UsedOutFileName() const { return m_UsedOutFileName; }
   void CompressionSetting(const int i) override { m_CompressionSetting = i; }
   void InitializeLastEvent(int eventnumber) override;
-  
+  //! compress baskets in parallel with nthreads ROOT implicit MT threads
+  //! this calls ROOT::EnableImplicitMT which is process wide
+  void ParallelCompression(const int nthreads) { m_CompressionThreads = nthreads; }
+  //! flush (and with implicit MT compress in parallel) every nevents events
+  //! ROOT optimizes the basket size of each branch at the first flush
+  void BasketOptimizationEvents(const int nevents) { m_AutoFlushEvents = nevents; }
+  //! time in ms the event loop spent in writing events (serialization, compression and file IO)
+  double WriteTime() const { return m_WriteTimer.get_accumulated_time(); }
+
  private:
   int outfile_open_first_write();
   PHNodeIOManager *dstOut{nullptr};
   int m_SaveRunNodeFlag{1};
   int m_SaveDstNodeFlag{1};
   int m_CompressionSetting{505};
+  int m_CompressionThreads{0};
+  int m_AutoFlushEvents{0};
   bool m_LastEventInitialized{false};
   std::string m_FileNameStem;
   std::string m_UsedOutFileName;
@@ -51,6 +63,7 @@ class Fun4AllDstOutputManager : public Fun4AllOutputManager
   std::set<std::string> m_StripCompositeNodes;
   std::set<std::string> stripnodes;
   std::set<std::string> striprunnodes;
+  PHTimer m_WriteTimer{"DST write"};
 };
 
 #endif
@@ -20,6 +20,9 @@ class Fun4AllDummyInputManager : public Fun4AllInputManager
   int fileopen(const std::string&) override { return 0; }
   int fileclose() override { return 0; }
   int IsOpen() const override { return 1; }
+  // events come from generators whose random engines would be copied into
+  // every forked worker (same events in all workers), never fork
+  bool CanReopenAfterFork() const override { return false; }
   int run(const int /*nevents=0*/) override;
   int GetSyncObject(SyncObject** /*mastersync*/) override { return Fun4AllReturnCodes::SYNC_NOOBJECT; }
   int SyncIt(const SyncObject* /*mastersync*/) override { return Fun4AllReturnCodes::SYNC_OK; }
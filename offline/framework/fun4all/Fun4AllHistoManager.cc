@@ -8,6 +8,7 @@
 
 #include <TFile.h>
 #include <TH1.h>
+#include <TList.h>
 #include <THnBase.h>
 #include <TNamed.h>
 #include <TSystem.h>
@@ -28,6 +29,10 @@ Fun4AllHistoManager::Fun4AllHistoManager(const std::string &name)
 
 Fun4AllHistoManager::~Fun4AllHistoManager()
 {
+  for (auto *buffer : m_FillBuffers)
+  {
+    delete buffer;
+  }
   while (Histo.begin() != Histo.end())
   {
     if (Verbosity() > 0)
@@ -95,6 +100,7 @@ int Fun4AllHistoManager::dumpHistos(const std::string &filename, const std::stri
       m_outfilename = Name() + std::format("-{:08}.root", runnumber);
     }
   }
+  FlushFills();
   std::string theoutfile = m_outfilename;
   if (ApplyFileRule())
   {
@@ -116,7 +122,14 @@ int Fun4AllHistoManager::dumpHistos(const std::string &filename, const std::stri
     theoutfile = fullpath + std::string("/") + std::string(p.stem()) + runseg + std::string(p.extension());
     m_CurrentSegment++;
   }
+  if (!m_FileNameSuffix.empty())
+  {
+    std::filesystem::path p = theoutfile;
+    p.replace_filename(std::string(p.stem()) + m_FileNameSuffix + std::string(p.extension()));
+    theoutfile = p;
+  }
   m_LastClosedFileName = theoutfile;
+  m_ClosedFileNames.push_back(theoutfile);
   std::filesystem::path pout = theoutfile;
   theoutfile = theoutfile + std::string("?reproducible=") + std::string(pout.filename());
   std::cout << "Fun4AllHistoManager::dump() Writing root file: " <<  m_LastClosedFileName << std::endl;
@@ -194,6 +207,51 @@ int Fun4AllHistoManager::dumpHistos(const std::string &filename, const std::stri
   return iret;
 }
 
+int Fun4AllHistoManager::AddHistosFromFile(const std::string &filename)
+{
+  FlushFills();
+  TFile hfile(filename.c_str(), "READ");
+  if (!hfile.IsOpen())
+  {
+    std::cout << PHWHERE << " Could not open " << filename << std::endl;
+    return -1;
+  }
+  int iret = 0;
+  for (auto &hiter : Histo)
+  {
+    // dumpHistos writes the objects under their key (directory/name)
+    TObject *fromfile = hfile.Get(hiter.first.c_str());
+    if (!fromfile)
+    {
+      continue;
+    }
+    TList list;
+    list.Add(fromfile);
+    Long64_t merged = -1;
+    if (TH1 *h = dynamic_cast<TH1 *>(hiter.second))
+    {
+      merged = h->Merge(&list);
+    }
+    else if (THnBase *hn = dynamic_cast<THnBase *>(hiter.second))
+    {
+      merged = hn->Merge(&list);
+    }
+    else
+    {
+      std::cout << PHWHERE << " " << hiter.first << " is not a TH1 or THnBase, the entries in "
+                << filename << " are not added" << std::endl;
+      iret = -1;
+      continue;
+    }
+    if (merged < 0)
+    {
+      std::cout << PHWHERE << " adding " << hiter.first << " from " << filename << " failed" << std::endl;
+      iret = -1;
+    }
+  }
+  return iret;
+}
+
 bool Fun4AllHistoManager::registerHisto(TNamed *h1d, const int replace)
 {
   return registerHisto(h1d->GetName(), h1d, replace);
@@ -345,6 +403,7 @@ void Fun4AllHistoManager::Print(const std::string &what) const
 
 void Fun4AllHistoManager::Reset()
 {
+  FlushFills();  // the buffered fills belong to the old content
   std::map<const std::string, TNamed *>::const_iterator hiter;
   for (hiter = Histo.begin(); hiter != Histo.end(); ++hiter)
   {
@@ -397,6 +456,14 @@ void Fun4AllHistoManager::CopyRolloverSetting(const Fun4AllOutputManager *outman
 
 bool Fun4AllHistoManager::isEmpty() const
 {
+  for (auto *buffer : m_FillBuffers)
+  {
+    if (buffer->size() > 0)
+    {
+      std::cout << buffer->Histo()->GetName() << " has " << buffer->size() << " buffered fills" << std::endl;
+      return false;
+    }
+  }
   bool thisempty = true;
   for (const auto &hiter : Histo)
   {
@@ -431,3 +498,34 @@ bool Fun4AllHistoManager::isEmpty() const
   }
   return thisempty;
 }
+
+HistoFillBuffer *Fun4AllHistoManager::makeFillBuffer(TH1 *h, const std::size_t capacity)
+{
+  if (!HistoFillBuffer::Supported(h))
+  {
+    std::cout << PHWHERE << " cannot buffer fills of " << (h ? h->GetName() : "nullptr")
+              << ", only TH1, TH2 and TProfile are supported" << std::endl;
+    return nullptr;
+  }
+  HistoFillBuffer *buffer = new HistoFillBuffer(h, capacity);
+  m_FillBuffers.push_back(buffer);
+  // nothing else flushes a capacity 0 buffer during the run
+  if (capacity == 0 && !m_FlushFillsEveryEvent)
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << Name() << ": fill buffer of " << h->GetName()
+                << " has capacity 0, flushing the fills at the end of every event" << std::endl;
+    }
+    m_FlushFillsEveryEvent = true;
+  }
+  return buffer;
+}
+
+void Fun4AllHistoManager::FlushFills()
+{
+  for (auto *buffer : m_FillBuffers)
+  {
+    buffer->Flush();
+  }
+}
@@ -4,11 +4,15 @@
 #define FUN4ALL_FUN4ALLHISTOMANAGER_H
 
 #include "Fun4AllBase.h"
+#include "HistoFillBuffer.h"
 
+#include <cstddef>
 #include <map>
 #include <string>
+#include <vector>
 
 class Fun4AllOutputManager;
+class TH1;
 class TNamed;
 
 class Fun4AllHistoManager : public Fun4AllBase
@@ -45,6 +49,9 @@ class Fun4AllHistoManager : public Fun4AllBase
   void Reset();
   int RunAfterClosing();
   int dumpHistos(const std::string &filename = "", const std::string &openmode = "RECREATE");
+  //! add the histograms in a file written by dumpHistos of another instance
+  //! of this manager (forked Fun4AllServer worker) to the registered ones
+  int AddHistosFromFile(const std::string &filename);
   const std::string &OutFileName() { return m_outfilename; }
   void setOutfileName(const std::string &filename) { m_outfilename = filename; }
   void SetClosingScript(const std::string &script) { m_RunAfterClosingScript = script; }
@@ -61,11 +68,32 @@ class Fun4AllHistoManager : public Fun4AllBase
   bool ApplyFileRule() const { return m_UseFileRuleFlag; }
   void CopyRolloverSetting(const Fun4AllOutputManager *outman);
   const std::string &LastClosedFileName() const { return m_LastClosedFileName; }
+  //! all files written by dumpHistos, in order (one per segment with file rule)
+  const std::vector<std::string> &ClosedFileNames() const { return m_ClosedFileNames; }
+  //! suffix inserted before the extension of all files written by dumpHistos (used by forked workers)
+  void FileNameSuffix(const std::string &suffix) { m_FileNameSuffix = suffix; }
   bool isEmpty() const;
 
+  //! buffer for the fills of a histogram (TH1, TH2 or TProfile), owned by this manager.
+  //! The buffered fills are written with FillN when the buffer is full, by FlushFills()
+  //! and before the histograms are saved, reset or checked. Every call returns a new
+  //! buffer, threads filling the same histogram each use their own with capacity 0.
+  //! A buffer with capacity 0 is never flushed when it is filled, it switches on
+  //! FlushFillsEveryEvent() so it does not grow for the whole run.
+  //! Returns nullptr for unsupported histograms
+  HistoFillBuffer *makeFillBuffer(TH1 *h, const std::size_t capacity = HistoFillBuffer::kDefaultCapacity);
+  //! write all buffered fills into their histograms. Not thread safe, only call
+  //! it when the threads which fill the buffers are joined
+  void FlushFills();
+  //! flush the buffers at the end of every event, after process_event of all modules
+  //! (default at the end of the run only, on for managers with a capacity 0 buffer)
+  void FlushFillsEveryEvent(const bool b) { m_FlushFillsEveryEvent = b; }
+  bool FlushFillsEveryEvent() const { return m_FlushFillsEveryEvent; }
+
 private:
   bool m_LastEventInitializedFlag{false};
   bool m_UseFileRuleFlag{false};
+  bool m_FlushFillsEveryEvent{false};
   int m_CurrentSegment{0};
   int m_EventRollover{0};
   int m_LastEventNumber{std::numeric_limits<int>::max()};
@@ -75,7 +103,10 @@ private:
   std::string m_RunAfterClosingScript;
   std::string m_ClosingArgs;
   std::string m_LastClosedFileName;
+  std::string m_FileNameSuffix;
+  std::vector<std::string> m_ClosedFileNames;
   std::map<const std::string, TNamed *> Histo;
+  std::vector<HistoFillBuffer *> m_FillBuffers;
 };
 
 #endif /* __FUN4ALLHISTOMANAGER_H */
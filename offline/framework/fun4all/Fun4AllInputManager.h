@@ -40,6 +40,16 @@ class Fun4AllInputManager : public Fun4AllBase, public InputFileHandler
   virtual int NoSyncPushBackEvents(const int /*nevt*/) { return -1; }
   virtual void setSyncManager(Fun4AllSyncManager *master) { m_MySyncManager = master; }
   virtual int ResetEvent() { return 0; }
+  //! the workers forked by Fun4AllServer::ForkAfterInit inherit the open input files
+  //! and share their file offsets with the main process. Right after the fork a worker
+  //! reopens the current file and goes back to the same event. Managers which cannot
+  //! do this must not have a file open when the server forks
+  virtual bool CanReopenAfterFork() const { return !IsOpen(); }
+  virtual int ReopenAfterFork() { return 0; }
+  //! skip up to nevt events of the current file without reading them, returns the
+  //! number of skipped events (0 at the end of the file or if this is not possible).
+  //! Forked workers use this for the event chunks of the other workers
+  virtual int SkipInFile(const int /*nevt*/) { return 0; }
   virtual void SetRunNumber(const int runno) { m_MyRunNumber = runno; }
   virtual int RunNumber() const { return m_MyRunNumber; }
 
@@ -56,6 +66,8 @@ class Fun4AllInputManager : public Fun4AllBase, public InputFileHandler
   Fun4AllSyncManager *MySyncManager() { return m_MySyncManager; }
   void DisableReadCache() { m_disable_read_cache_flag = true; }
   bool ReadCacheDisabled() const { return m_disable_read_cache_flag; }
+  //! local SubsysRecos which can reject events (see RejectEvent()) are registered
+  bool HasRejectModules() const { return !m_SubsystemsVector.empty(); }
 
  private:
   Fun4AllSyncManager *m_MySyncManager {nullptr};
@@ -12,6 +12,8 @@
 #include "SubsysReco.h"
 
 #include <phool/PHCompositeNode.h>
+#include <phool/PHDataNode.h>
+#include <phool/PHIODataNode.h>
 #include <phool/PHNode.h>  // for PHNode
 #include <phool/PHNodeIterator.h>
 #include <phool/PHNodeReset.h>
@@ -25,21 +27,55 @@
 
 #include <Rtypes.h>  // for kMAXSIGNALS
 #include <TDirectory.h>
+#include <TFileMerger.h>
 #include <TH1.h>
 #include <TROOT.h>
 #include <TSysEvtHandler.h>  // for ESignals
 
 #include <TSystem.h>
 
+#include <sys/mman.h>  // for mmap
+#include <sys/wait.h>  // for waitpid
+#include <unistd.h>    // for fork
+
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>  // for fflush
 #include <cstdlib>
+#include <cstring>  // for strerror
 #include <exception>
+#include <filesystem>
+#include <format>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <memory>  // for allocator_traits<>::value_type
+#include <new>     // for placement new
+#include <set>
 #include <sstream>
+#include <vector>
 
 // #define FFAMEMTRACKER
 
+namespace
+{
+  // exchange the objects of the main node tree and of an event in flight
+  void ExchangeNodeData(const std::vector<PHNode *> &mainnodes, const std::vector<PHNode *> &slotnodes)
+  {
+    for (size_t i = 0; i < mainnodes.size(); ++i)
+    {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      auto *mainnode = static_cast<PHDataNode<PHObject> *>(mainnodes[i]);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      auto *slotnode = static_cast<PHDataNode<PHObject> *>(slotnodes[i]);
+      PHObject *obj = mainnode->getData();
+      mainnode->setData(slotnode->getData());
+      slotnode->setData(obj);
+    }
+  }
+}  // namespace
+
 Fun4AllServer *Fun4AllServer::__instance = nullptr;
 
 Fun4AllServer *Fun4AllServer::instance()
@@ -64,6 +100,8 @@ Fun4AllServer::Fun4AllServer(const std::string &name)
 
 Fun4AllServer::~Fun4AllServer()
 {
+  DrainEventsInFlight(true);
+  DeleteEventsInFlight();
   Reset();
   delete beginruntimestamp;
   while (Subsystems.begin() != Subsystems.end())
@@ -269,10 +307,14 @@ int Fun4AllServer::registerSubsystem(SubsysReco *subsystem, const std::string &t
   std::string timer_name;
   timer_name = subsystem->Name() + "_" + topnodename;
   PHTimer timer(timer_name);
-  if (!timer_map.contains(timer_name))
+  auto titer = timer_map.find(timer_name);
+  if (titer == timer_map.end())
   {
-    timer_map.insert(make_pair(timer_name, timer));
+    titer = timer_map.insert(make_pair(timer_name, timer)).first;
   }
+  // looked up once here instead of for every event
+  SubsystemTimers.push_back(&titer->second);
+  SubsystemTDirs.push_back(topnodename + "/" + subsystem->Name());
   RetCodes.push_back(iret);  // vector with return codes
   return 0;
 }
@@ -321,6 +363,8 @@ int Fun4AllServer::unregisterSubsystemsNow()
     delete (*removeiter).first;
     // also update the vector with return codes
     RetCodes.erase(RetCodes.begin() + index);
+    SubsystemTimers.erase(SubsystemTimers.begin() + index);
+    SubsystemTDirs.erase(SubsystemTDirs.begin() + index);
     std::vector<Fun4AllOutputManager *>::iterator outiter;
     for (outiter = OutputManager.begin(); outiter != OutputManager.end(); ++outiter)
     {
@@ -507,8 +551,6 @@ TNamed *Fun4AllServer::getHisto(const std::string &hname) const
 int Fun4AllServer::process_event()
 {
   eventcounter++;
-  unsigned icnt = 0;
-  int eventbad = 0;
   if (ScreamEveryEvent)
   {
     std::cout << "*******************************************************************************" << std::endl;
@@ -528,17 +570,47 @@ int Fun4AllServer::process_event()
   }
   if (unregistersubsystem)
   {
+    DeleteEventsInFlight();  // the module indices change, run() finished the events in flight
     unregisterSubsystemsNow();
   }
   gROOT->cd(default_Tdirectory.c_str());
   std::string currdir = gDirectory->GetPath();
-  for (auto &Subsystem : Subsystems)
+  if (m_EventsInFlight > 1 && (!m_InFlightSlots.empty() || FindThreadSafeModules()))
+  {
+    return process_event_in_flight(currdir);
+  }
+  int eventbad = 0;
+  int iret = ProcessSubsystems(0, Subsystems.size(), eventbad);
+  if (iret)
+  {
+    return iret;
+  }
+  WriteEvent(eventbad, currdir);
+  ResetEventSubsystems(0, Subsystems.size());
+  for (auto &syncman : SyncManagers)
+  {
+    if (Verbosity() >= VERBOSITY_EVEN_MORE)
+    {
+      std::cout << "Fun4AllServer::process_event Resetting Event for Sync Manager " << syncman->Name() << std::endl;
+    }
+    syncman->ResetEvent();
+  }
+  Fun4AllMonitoring::instance()->Snapshot("Event");
+  ResetNodeTree();
+  return 0;
+}
+
+// run the modules [ifirst, ilast) on their top nodes
+int Fun4AllServer::ProcessSubsystems(const unsigned ifirst, const unsigned ilast, int &eventbad)
+{
+  for (unsigned icnt = ifirst; icnt < ilast; ++icnt)
   {
+    auto &Subsystem = Subsystems[icnt];
     if (Verbosity() >= VERBOSITY_MORE)
     {
       std::cout << "Fun4AllServer::process_event processing " << Subsystem.first->Name() << std::endl;
     }
-    std::string newdirname = Subsystem.second->getName() + "/" + Subsystem.first->Name();
+    const std::string &newdirname = SubsystemTDirs[icnt];
     if (!gROOT->cd(newdirname.c_str()))
     {
       std::cout << PHWHERE << "Unexpected TDirectory Problem cd'ing to "
@@ -559,20 +631,10 @@ int Fun4AllServer::process_event()
 
     try
     {
-      std::string timer_name;
-      timer_name = Subsystem.first->Name() + "_" + Subsystem.second->getName();
-      std::map<const std::string, PHTimer>::iterator titer = timer_map.find(timer_name);
-      bool timer_found = false;
-      if (titer != timer_map.end())
-      {
-        timer_found = true;
-        titer->second.restart();
-      }
-      else
-      {
-        std::cout << "could not find timer for " << timer_name << std::endl;
-      }
+      PHTimer *subsystimer = SubsystemTimers[icnt];
+      subsystimer->restart();
 #ifdef FFAMEMTRACKER
+      const std::string &timer_name = subsystimer->get_name();
       ffamemtracker->Start(timer_name, "SubsysReco");
       ffamemtracker->Snapshot("Fun4AllServerProcessEvent");
 #endif
@@ -596,10 +658,7 @@ int Fun4AllServer::process_event()
         std::cout << "error: " << e.what() << std::endl;
         gSystem->Exit(1);
       }
-      if (timer_found)
-      {
-        titer->second.stop();
-      }
+      subsystimer->stop();
 #ifdef FFAMEMTRACKER
       ffamemtracker->Stop(timer_name, "SubsysReco");
 #endif
@@ -617,49 +676,14 @@ int Fun4AllServer::process_event()
                 << Subsystem.first->Name() << std::endl;
       exit(1);
     }
-    if (RetCodes[icnt])
+    int iret = CheckRetCode(icnt, eventbad);
+    if (iret == Fun4AllReturnCodes::ABORTEVENT)
     {
-      if (RetCodes[icnt] == Fun4AllReturnCodes::DISCARDEVENT)
-      {
-        if (Verbosity() >= VERBOSITY_EVEN_MORE)
-        {
-          std::cout << "Fun4AllServer::Discard Event by " << Subsystem.first->Name() << std::endl;
-        }
-      }
-      else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTEVENT)
-      {
-        retcodesmap[Fun4AllReturnCodes::ABORTEVENT]++;
-        eventbad = 1;
-        if (Verbosity() >= VERBOSITY_MORE)
-        {
-          std::cout << "Fun4AllServer::Abort Event by " << Subsystem.first->Name() << std::endl;
-        }
-        break;
-      }
-      else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTRUN)
-      {
-        retcodesmap[Fun4AllReturnCodes::ABORTRUN]++;
-        std::cout << "Fun4AllServer::Abort Run by " << Subsystem.first->Name() << std::endl;
-        return Fun4AllReturnCodes::ABORTRUN;
-      }
-      else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTPROCESSING)
-      {
-        eventbad = 1;
-        retcodesmap[Fun4AllReturnCodes::ABORTPROCESSING]++;
-        std::cout << "Fun4AllServer::Abort Processing by " << Subsystem.first->Name() << std::endl;
-        return Fun4AllReturnCodes::ABORTPROCESSING;
-      }
-      else
-      {
-        std::cout << "Fun4AllServer::Unknown return code: "
-                  << RetCodes[icnt] << " from process_event method of "
-                  << Subsystem.first->Name() << std::endl;
-        std::cout << "This smells like an uninitialized return code and" << std::endl;
-        std::cout << "it is too dangerous to continue, this Run will be aborted" << std::endl;
-        std::cout << "If you do not know how to fix this please send mail to" << std::endl;
-        std::cout << "phenix-off-l with this message" << std::endl;
-        return Fun4AllReturnCodes::ABORTRUN;
-      }
+      break;
+    }
+    if (iret)
+    {
+      return iret;
     }
     subsystem_timer.stop();
     double TimeSubsystem = subsystem_timer.elapsed();
@@ -668,12 +692,73 @@ int Fun4AllServer::process_event()
       std::cout << "Fun4AllServer::process_event processing " << Subsystem.first->Name()
                 << " processing total time: " << TimeSubsystem << " ms" << std::endl;
     }
-    icnt++;
   }
+  return 0;
+}
+
+// returns ABORTEVENT, ABORTRUN or ABORTPROCESSING if the processing of the event stops
+int Fun4AllServer::CheckRetCode(const unsigned icnt, int &eventbad)
+{
+  if (RetCodes[icnt])
+  {
+    if (RetCodes[icnt] == Fun4AllReturnCodes::DISCARDEVENT)
+    {
+      if (Verbosity() >= VERBOSITY_EVEN_MORE)
+      {
+        std::cout << "Fun4AllServer::Discard Event by " << Subsystems[icnt].first->Name() << std::endl;
+      }
+    }
+    else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTEVENT)
+    {
+      retcodesmap[Fun4AllReturnCodes::ABORTEVENT]++;
+      eventbad = 1;
+      if (Verbosity() >= VERBOSITY_MORE)
+      {
+        std::cout << "Fun4AllServer::Abort Event by " << Subsystems[icnt].first->Name() << std::endl;
+      }
+      return Fun4AllReturnCodes::ABORTEVENT;
+    }
+    else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTRUN)
+    {
+      retcodesmap[Fun4AllReturnCodes::ABORTRUN]++;
+      std::cout << "Fun4AllServer::Abort Run by " << Subsystems[icnt].first->Name() << std::endl;
+      return Fun4AllReturnCodes::ABORTRUN;
+    }
+    else if (RetCodes[icnt] == Fun4AllReturnCodes::ABORTPROCESSING)
+    {
+      eventbad = 1;
+      retcodesmap[Fun4AllReturnCodes::ABORTPROCESSING]++;
+      std::cout << "Fun4AllServer::Abort Processing by " << Subsystems[icnt].first->Name() << std::endl;
+      return Fun4AllReturnCodes::ABORTPROCESSING;
+    }
+    else
+    {
+      std::cout << "Fun4AllServer::Unknown return code: "
+                << RetCodes[icnt] << " from process_event method of "
+                << Subsystems[icnt].first->Name() << std::endl;
+      std::cout << "This smells like an uninitialized return code and" << std::endl;
+      std::cout << "it is too dangerous to continue, this Run will be aborted" << std::endl;
+      std::cout << "If you do not know how to fix this please send mail to" << std::endl;
+      std::cout << "phenix-off-l with this message" << std::endl;
+      return Fun4AllReturnCodes::ABORTRUN;
+    }
+  }
+  return 0;
+}
+
+void Fun4AllServer::WriteEvent(const int eventbad, const std::string &currdir)
+{
   if (!eventbad)
   {
     retcodesmap[Fun4AllReturnCodes::EVENT_OK]++;
   }
+  for (auto *histit : HistoManager)
+  {
+    if (histit->FlushFillsEveryEvent())
+    {
+      histit->FlushFills();
+    }
+  }
 
   gROOT->cd(currdir.c_str());
   //  mainIter.print();
@@ -786,25 +871,349 @@ int Fun4AllServer::process_event()
       }
     }
   }
-  for (auto &Subsystem : Subsystems)
+}
+
+void Fun4AllServer::ResetEventSubsystems(const unsigned ifirst, const unsigned ilast)
+{
+  for (unsigned icnt = ifirst; icnt < ilast; ++icnt)
   {
+    auto &Subsystem = Subsystems[icnt];
     if (Verbosity() >= VERBOSITY_EVEN_MORE)
     {
       std::cout << "Fun4AllServer::process_event Resetting Event " << Subsystem.first->Name() << std::endl;
     }
     Subsystem.first->ResetEvent(Subsystem.second);
   }
-  for (auto &syncman : SyncManagers)
+}
+
+// the modules before the thread safe modules run on the main node tree, then
+// the event moves to a free node tree of the events in flight and the thread
+// safe modules process it in their own thread. Once the maximum number of
+// events is in flight the oldest one is finished
+int Fun4AllServer::process_event_in_flight(const std::string &currdir)
+{
+  int eventbad = 0;
+  int iret = ProcessSubsystems(0, m_ThreadSafeFirst, eventbad);
+  if (iret)
   {
-    if (Verbosity() >= VERBOSITY_EVEN_MORE)
+    return iret;
+  }
+  // aborted events are not written, they do not have to wait for the events in flight
+  if (eventbad || (m_InFlightSlots.empty() && !SetupEventsInFlight()))
+  {
+    if (!eventbad)
     {
-      std::cout << "Fun4AllServer::process_event Resetting Event for Sync Manager " << syncman->Name() << std::endl;
+      iret = ProcessSubsystems(m_ThreadSafeFirst, Subsystems.size(), eventbad);
+      if (iret)
+      {
+        return iret;
+      }
+    }
+    WriteEvent(eventbad, currdir);
+    ResetEventSubsystems(0, Subsystems.size());
+    for (auto &syncman : SyncManagers)
+    {
+      syncman->ResetEvent();
     }
+    Fun4AllMonitoring::instance()->Snapshot("Event");
+    ResetNodeTree();
+    return 0;
+  }
+  PHNodeIterator iter(TopNode);
+  PHCompositeNode *dstNode = dynamic_cast<PHCompositeNode *>(iter.findFirst("PHCompositeNode", "DST"));
+  int newcount = CountOutNodes(dstNode);
+  if (newcount != static_cast<int>(m_InFlightDstNodes.size()))
+  {
+    iter.print();
+    std::cout << PHWHERE << " FATAL: Someone changed the number of DST nodes with events in flight, from "
+              << m_InFlightDstNodes.size() << " to " << newcount << std::endl;
+    exit(1);
+  }
+  unsigned islot = 0;
+  while (m_InFlightSlots[islot].busy)
+  {
+    ++islot;
+  }
+  EventInFlight &slot = m_InFlightSlots[islot];
+  for (auto *node : m_InFlightDstNodes)
+  {
+    if (node->getType() == "PHIODataNode")
+    {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<PHIODataNode<TObject> *>(node)->lazyRead();
+    }
+  }
+  // root notices the changed object pointers behind the branch addresses
+  // of the input and output managers (TBranchElement::ValidateAddress)
+  ExchangeNodeData(m_InFlightDstNodes, slot.dstNodes);
+  slot.busy = true;
+  slot.eventnumber = eventnumber;
+  slot.done = std::async(std::launch::async, [this, islot]()
+                         { return ProcessEventInFlight(islot); });
+  m_InFlightQueue.push_back(islot);
+  // the main node tree has the reset objects of the slot now, the input
+  // managers and the modules before the thread safe ones are done with this event
+  ResetEventSubsystems(0, m_ThreadSafeFirst);
+  for (auto &syncman : SyncManagers)
+  {
     syncman->ResetEvent();
   }
-  Fun4AllMonitoring::instance()->Snapshot("Event");
+  if (m_InFlightQueue.size() < m_InFlightSlots.size())
+  {
+    return 0;
+  }
+  return RetireEventInFlight(false);
+}
+
+// executed in the thread of an event in flight, returns the index after the last module
+int Fun4AllServer::ProcessEventInFlight(const unsigned islot)
+{
+  EventInFlight &slot = m_InFlightSlots[islot];
+  unsigned icnt = m_ThreadSafeFirst;
+  for (; icnt < m_ThreadSafeLast; ++icnt)
+  {
+    SubsysReco *subsys = Subsystems[icnt].first;
+    try
+    {
+      slot.retcodes[icnt] = subsys->process_event(slot.topNode);
+    }
+    catch (const std::exception &e)
+    {
+      slot.error = "caught exception thrown during process_event from " + subsys->Name() + ", error: " + e.what();
+      return icnt;
+    }
+    catch (...)
+    {
+      slot.error = "caught unknown type exception thrown during process_event from " + subsys->Name();
+      return icnt;
+    }
+    if (slot.retcodes[icnt] && slot.retcodes[icnt] != Fun4AllReturnCodes::DISCARDEVENT)
+    {
+      return icnt + 1;
+    }
+  }
+  return icnt;
+}
+
+// wait for the oldest event in flight, move it back to the main node tree
+// and run the remaining modules and the output managers
+int Fun4AllServer::RetireEventInFlight(const bool discard)
+{
+  const unsigned islot = m_InFlightQueue.front();
+  m_InFlightQueue.pop_front();
+  EventInFlight &slot = m_InFlightSlots[islot];
+  unsigned ilast = slot.done.get();
+  PHNodeIterator iter(slot.topNode);
+  int newcount = CountOutNodes(dynamic_cast<PHCompositeNode *>(iter.findFirst("PHCompositeNode", "DST")));
+  if (newcount != static_cast<int>(slot.dstNodes.size()))
+  {
+    iter.print();
+    std::cout << PHWHERE << " FATAL: a thread safe module created nodes in process_event, from "
+              << slot.dstNodes.size() << " to " << newcount << std::endl;
+    exit(1);
+  }
+  if (!slot.error.empty())
+  {
+    std::cout << PHWHERE << " " << slot.error << std::endl;
+    gSystem->Exit(1);
+  }
+  ExchangeNodeData(m_InFlightDstNodes, slot.dstNodes);
+  slot.busy = false;
+  slot.error.clear();
+  const int currentevent = eventnumber;
+  eventnumber = slot.eventnumber;
+  int iret = 0;
+  if (!discard)
+  {
+    gROOT->cd(default_Tdirectory.c_str());
+    std::string currdir = gDirectory->GetPath();
+    int eventbad = 0;
+    for (unsigned icnt = m_ThreadSafeFirst; icnt < ilast && !iret; ++icnt)
+    {
+      RetCodes[icnt] = slot.retcodes[icnt];
+      iret = CheckRetCode(icnt, eventbad);
+    }
+    if (!eventbad)
+    {
+      iret = ProcessSubsystems(m_ThreadSafeLast, Subsystems.size(), eventbad);
+    }
+    if (iret && iret != Fun4AllReturnCodes::ABORTEVENT)
+    {
+      eventnumber = currentevent;
+      return iret;
+    }
+    iret = 0;
+    WriteEvent(eventbad, currdir);
+    ResetEventSubsystems(m_ThreadSafeFirst, Subsystems.size());
+    Fun4AllMonitoring::instance()->Snapshot("Event");
+  }
   ResetNodeTree();
-  return 0;
+  eventnumber = currentevent;
+  return iret;
+}
+
+int Fun4AllServer::DrainEventsInFlight(const bool discard)
+{
+  int iret = 0;
+  while (!m_InFlightQueue.empty())
+  {
+    int iretevt = RetireEventInFlight(discard || iret);
+    if (!iret)
+    {
+      iret = iretevt;
+    }
+  }
+  return iret;
+}
+
+// the thread safe modules are the first consecutive ThreadSafe() modules on the TOP node
+bool Fun4AllServer::FindThreadSafeModules()
+{
+  unsigned nsubsys = Subsystems.size();
+  m_ThreadSafeFirst = 0;
+  while (m_ThreadSafeFirst < nsubsys && !(Subsystems[m_ThreadSafeFirst].first->ThreadSafe() && Subsystems[m_ThreadSafeFirst].second == TopNode))
+  {
+    ++m_ThreadSafeFirst;
+  }
+  m_ThreadSafeLast = m_ThreadSafeFirst;
+  while (m_ThreadSafeLast < nsubsys && Subsystems[m_ThreadSafeLast].first->ThreadSafe() && Subsystems[m_ThreadSafeLast].second == TopNode)
+  {
+    ++m_ThreadSafeLast;
+  }
+  if (m_ThreadSafeFirst == m_ThreadSafeLast)
+  {
+    std::cout << "Fun4AllServer: no thread safe module on the TOP node, processing events serially" << std::endl;
+    m_EventsInFlight = 1;
+    return false;
+  }
+  return true;
+}
+
+bool Fun4AllServer::SetupEventsInFlight()
+{
+  PHNodeIterator iter(TopNode);
+  if (!iter.findFirst("PHCompositeNode", "DST"))
+  {
+    std::cout << "Fun4AllServer: no DST node, processing events serially" << std::endl;
+    m_EventsInFlight = 1;
+    return false;
+  }
+  // the modules create and delete root objects in several threads
+  ROOT::EnableThreadSafety();
+  m_InFlightSlots.resize(m_EventsInFlight);
+  for (unsigned islot = 0; islot < m_InFlightSlots.size(); ++islot)
+  {
+    EventInFlight &slot = m_InFlightSlots[islot];
+    slot.topNode = new PHCompositeNode(TopNode->getName());
+    slot.retcodes.resize(Subsystems.size());
+    if (!MirrorNodeTree(TopNode, slot.topNode, false, islot))
+    {
+      std::cout << "Fun4AllServer: cannot build the node trees for events in flight, processing events serially" << std::endl;
+      DeleteEventsInFlight();
+      m_EventsInFlight = 1;
+      return false;
+    }
+  }
+  if (Verbosity() > 0)
+  {
+    std::cout << "Fun4AllServer: " << m_EventsInFlight << " events in flight, running "
+              << Subsystems[m_ThreadSafeFirst].first->Name() << " to "
+              << Subsystems[m_ThreadSafeLast - 1].first->Name() << " concurrently" << std::endl;
+  }
+  return true;
+}
+
+// copy the node structure, PHObjects under DST are cloned, all others are shared
+// NOLINTNEXTLINE(misc-no-recursion)
+bool Fun4AllServer::MirrorNodeTree(PHCompositeNode *from, PHCompositeNode *to, const bool indst, const unsigned islot)
+{
+  EventInFlight &slot = m_InFlightSlots[islot];
+  PHNodeIterator nodeiter(from);
+  PHPointerListIterator<PHNode> iterat(nodeiter.ls());
+  PHNode *thisNode;
+  while ((thisNode = iterat()))
+  {
+    if (thisNode->getType() == "PHCompositeNode")
+    {
+      PHCompositeNode *newNode = new PHCompositeNode(thisNode->getName());
+      to->addNode(newNode);
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      if (!MirrorNodeTree(static_cast<PHCompositeNode *>(thisNode), newNode, indst || (from == TopNode && thisNode->getName() == "DST"), islot))
+      {
+        return false;
+      }
+      continue;
+    }
+    if ((thisNode->getType() != "PHDataNode" && thisNode->getType() != "PHIODataNode") || thisNode->getObjectType() != "PHObject")
+    {
+      if (indst)
+      {
+        std::cout << PHWHERE << " " << thisNode->getName() << " under DST is no PHObject, it cannot be moved to an event in flight" << std::endl;
+        return false;
+      }
+      continue;  // not visible to the events in flight
+    }
+    if (thisNode->getType() == "PHIODataNode")
+    {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<PHIODataNode<TObject> *>(thisNode)->lazyRead();
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    PHObject *obj = static_cast<PHDataNode<PHObject> *>(thisNode)->getData();
+    if (!obj)
+    {
+      continue;
+    }
+    if (indst)
+    {
+      obj = obj->CloneMe();
+      if (!obj)
+      {
+        std::cout << PHWHERE << " cannot clone " << thisNode->getName() << " for the events in flight" << std::endl;
+        return false;
+      }
+      obj->Reset();
+    }
+    PHNode *newNode = nullptr;
+    if (thisNode->getType() == "PHIODataNode")
+    {
+      newNode = new PHIODataNode<PHObject>(obj, thisNode->getName(), "PHObject");
+    }
+    else
+    {
+      newNode = new PHDataNode<PHObject>(obj, thisNode->getName(), "PHObject");
+    }
+    to->addNode(newNode);
+    if (indst)
+    {
+      slot.dstNodes.push_back(newNode);
+      if (islot == 0)
+      {
+        m_InFlightDstNodes.push_back(thisNode);
+      }
+    }
+    else
+    {
+      slot.sharedNodes.push_back(newNode);
+    }
+  }
+  return true;
+}
+
+void Fun4AllServer::DeleteEventsInFlight()
+{
+  for (auto &slot : m_InFlightSlots)
+  {
+    for (auto *node : slot.sharedNodes)
+    {
+      // the objects belong to the main node tree
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+      static_cast<PHDataNode<PHObject> *>(node)->setData(nullptr);
+    }
+    delete slot.topNode;
+  }
+  m_InFlightSlots.clear();
+  m_InFlightDstNodes.clear();
 }
 
 int Fun4AllServer::ResetNodeTree()
@@ -859,6 +1268,8 @@ int Fun4AllServer::BeginRunTimeStamp(PHTimeStamp &TimeStp)
 int Fun4AllServer::BeginRun(const int runno)
 {
   eventcounter = 0;  // reset event counter for every new run
+  // modules registered now may add nodes, the node trees of the events in flight are rebuilt
+  DeleteEventsInFlight();
 #ifdef FFAMEMTRACKER
   ffamemtracker->Snapshot("Fun4AllServerBeginRun");
 #endif
@@ -1053,7 +1464,13 @@ int Fun4AllServer::MakeNodesPersistent(PHCompositeNode *startNode)  // NOLINT(mi
 
 int Fun4AllServer::EndRun(const int runno)
 {
+  DrainEventsInFlight();
   std::vector<std::pair<SubsysReco *, PHCompositeNode *>>::iterator iter;
+  // modules may look at their histograms in EndRun()
+  for (auto *histit : HistoManager)
+  {
+    histit->FlushFills();
+  }
   gROOT->cd(default_Tdirectory.c_str());
   std::string currdir = gDirectory->GetPath();
   for (iter = Subsystems.begin(); iter != Subsystems.end(); ++iter)
@@ -1189,6 +1606,37 @@ int Fun4AllServer::End()
       }
     }
   }
+  if (m_Forked)
+  {
+    if (m_WorkerId > 0)
+    {
+      // histograms of managers without file rule are saved by the macro after
+      // End(), which the workers never reach. They go to temporary files and
+      // are added to the histograms of the main process in MergeWorkerHistos()
+      for (auto *histit : HistoManager)
+      {
+        if (!histit->ApplyFileRule() && !histit->isEmpty())
+        {
+          if (histit->dumpHistos(ForkHistoFileName(histit)))
+          {
+            i = -1;
+          }
+        }
+      }
+      // the worker is done, the rest of the macro runs in the main process only.
+      // _exit does not run the atexit cleanup, which would close files the
+      // worker shares with the main process
+      std::cout << "Fun4AllServer: worker " << m_WorkerId << " processed its events, exiting" << std::endl;
+      std::cerr.flush();
+      fflush(nullptr);
+      _exit(i ? 1 : 0);
+    }
+    if (WaitForWorkers())
+    {
+      i = -1;
+    }
+    MergeWorkerHistos();
+  }
   if (ScreamEveryEvent)
   {
     std::cout << "*******************************************************************************" << std::endl;
@@ -1439,9 +1887,57 @@ int Fun4AllServer::run(const int nevnts, const bool require_nevents)
   int iret = 0;
   int icnt = 0;
   int icnt_good = 0;
+  // events read by all workers before this call, the fork happens at index 0
+  const long forkstart = m_ForkEventIndex;
+  if (m_Forked && m_ForkPositionsDiverged)
+  {
+    std::cout << PHWHERE << " the workers stopped at different events in run(nevents, true),"
+              << " they cannot continue processing events" << std::endl;
+    return -1;
+  }
+  if (require_nevents && m_EventsInFlight > 1)
+  {
+    std::cout << "Fun4AllServer: run(nevents, true) needs the return codes of every event, processing events serially" << std::endl;
+    DeleteEventsInFlight();
+    m_EventsInFlight = 1;
+  }
+  bool aborted = false;
   std::vector<Fun4AllSyncManager *>::const_iterator iter;
   while (!iret)
   {
+    if (unregistersubsystem)
+    {
+      iret = DrainEventsInFlight();  // before the module list changes in process_event()
+      if (iret)
+      {
+        aborted = true;
+        break;
+      }
+    }
+    if (m_Forked && (m_ForkEventIndex / m_ForkChunkSize) % m_ForkWorkers != m_WorkerId)
+    {
+      // skip the rest of a chunk of another worker without reading it. This
+      // stops at the end of the current input file, the first event of the next
+      // file is read below (which opens the file) and discarded
+      const long ichunk = m_ForkEventIndex / m_ForkChunkSize;
+      const long nextchunk = ichunk + (m_WorkerId - ichunk % m_ForkWorkers + m_ForkWorkers) % m_ForkWorkers;
+      long nskip = nextchunk * m_ForkChunkSize - m_ForkEventIndex;
+      if (nevnts > 0 && !require_nevents)
+      {
+        nskip = std::min(nskip, forkstart + nevnts - m_ForkEventIndex);
+      }
+      const int nskipped = SkipForkEvents(static_cast<int>(std::min(nskip, static_cast<long>(std::numeric_limits<int>::max()))));
+      m_ForkEventIndex += nskipped;
+      if (nevnts > 0 && (require_nevents ? m_ForkGoodEvents->load() : m_ForkEventIndex - forkstart) >= nevnts)
+      {
+        m_ForkPositionsDiverged = require_nevents;
+        break;
+      }
+      if (nskipped > 0)
+      {
+        continue;
+      }
+    }
     int resetnodetree = 0;
     for (iter = SyncManagers.begin(); iter != SyncManagers.end(); ++iter)
     {
@@ -1523,17 +2019,56 @@ int Fun4AllServer::run(const int nevnts, const bool require_nevents)
       setRun(runnumber);
       BeginRun(runnumber);
       ifirst = 0;
+      if (m_ForkWorkers > 1)
+      {
+        ForkWorkers();
+      }
     }
     else if (!run_number_forced)
     {
       if (currentrun != runnumber)
       {
+        if (!m_InFlightQueue.empty())
+        {
+          // the events in flight belong to the previous run, this event is
+          // read again once they are done
+          for (iter = SyncManagers.begin(); iter != SyncManagers.end(); ++iter)
+          {
+            (*iter)->PushBackInputMgrsEvents(1);
+          }
+          ResetNodeTree();
+          iret = DrainEventsInFlight();
+          aborted = (iret != 0);
+          continue;
+        }
         EndRun(runnumber);
         runnumber = currentrun;
         setRun(runnumber);
         BeginRun(runnumber);
       }
     }
+    if (m_Forked)
+    {
+      // chunks of events are handed out round robin. Events of other workers
+      // which could not be skipped above are read and discarded here, so all
+      // workers agree on the event sequence also across file boundaries
+      const long ichunk = m_ForkEventIndex / m_ForkChunkSize;
+      ++m_ForkEventIndex;
+      if (ichunk % m_ForkWorkers != m_WorkerId)
+      {
+        for (auto &syncman : SyncManagers)
+        {
+          syncman->ResetEvent();
+        }
+        ResetNodeTree();
+        if (nevnts > 0 && (require_nevents ? m_ForkGoodEvents->load() : m_ForkEventIndex - forkstart) >= nevnts)
+        {
+          m_ForkPositionsDiverged = require_nevents;
+          break;
+        }
+        continue;
+      }
+    }
     if (Verbosity() >= 1 && ((icnt + 1) % VerbosityDownscale() == 0))
     {
       std::cout << "Fun4AllServer::run - processing event "
@@ -1548,6 +2083,7 @@ int Fun4AllServer::run(const int nevnts, const bool require_nevents)
     }
 
     iret = process_event();
+    aborted = (iret != 0);
 
     if (icnt == 0 && Verbosity() > VERBOSITY_QUIET)
     {
@@ -1558,6 +2094,29 @@ int Fun4AllServer::run(const int nevnts, const bool require_nevents)
 
     ++icnt;  // completed one event processing
 
+    if (m_Forked)
+    {
+      // event limit counts the events of all workers, for require_nevents
+      // the good events are counted in memory shared by all workers
+      long nprocessed = m_ForkEventIndex - forkstart;
+      if (require_nevents)
+      {
+        if (std::find(RetCodes.begin(),
+                      RetCodes.end(),
+                      static_cast<int>(Fun4AllReturnCodes::ABORTEVENT)) == RetCodes.end())
+        {
+          ++(*m_ForkGoodEvents);
+        }
+        nprocessed = m_ForkGoodEvents->load();
+      }
+      if (iret || (nevnts > 0 && nprocessed >= nevnts))
+      {
+        m_ForkPositionsDiverged = require_nevents;
+        break;
+      }
+      continue;
+    }
+
     if (require_nevents)
     {
       if (std::find(RetCodes.begin(),
@@ -1576,9 +2135,250 @@ int Fun4AllServer::run(const int nevnts, const bool require_nevents)
       break;
     }
   }
+  // finish the events in flight, after an abort they are dropped
+  int iretinflight = DrainEventsInFlight(aborted);
+  if (!iret)
+  {
+    iret = iretinflight;
+  }
+  return iret;
+}
+
+//_________________________________________________________________
+int Fun4AllServer::SkipForkEvents(const int nevnts)
+{
+  // events of several sync managers cannot be skipped without syncing them
+  if (SyncManagers.size() != 1)
+  {
+    return 0;
+  }
+  return SyncManagers.front()->SkipInFile(nevnts);
+}
+
+//_________________________________________________________________
+void Fun4AllServer::ForkAfterInit(const int nworkers, const int chunksize)
+{
+  if (m_Forked)
+  {
+    std::cout << PHWHERE << " workers are already running, ignoring" << std::endl;
+    return;
+  }
+  m_ForkWorkers = nworkers;
+  m_ForkChunkSize = std::max(chunksize, 1);
+}
+
+//_________________________________________________________________
+std::string Fun4AllServer::WorkerFileName(const std::string &filename, const int iworker)
+{
+  std::filesystem::path p = filename;
+  p.replace_filename(std::string(p.stem()) + std::format("_worker{:03}", iworker) + std::string(p.extension()));
+  return p;
+}
+
+//_________________________________________________________________
+void Fun4AllServer::ForkWorkers()
+{
+  // the workers share the file offsets of all open input files with the main
+  // process, every input manager with an open file has to reopen it after the fork
+  for (auto *syncman : SyncManagers)
+  {
+    for (auto *inman : syncman->GetInputManagers())
+    {
+      if (!inman->CanReopenAfterFork())
+      {
+        std::cout << "*******************************************************************************" << std::endl;
+        std::cout << "Fun4AllServer::ForkAfterInit: input manager " << inman->Name()
+                  << " cannot be used in forked workers (open file: " << inman->FileName() << ")" << std::endl;
+        std::cout << "NOT forking, all events are processed in this process" << std::endl;
+        std::cout << "*******************************************************************************" << std::endl;
+        m_ForkWorkers = 0;
+        return;
+      }
+    }
+  }
+  // good events of all workers for run(nevents, true)
+  static_assert(std::atomic<long>::is_always_lock_free);
+  void *shared = mmap(nullptr, sizeof(std::atomic<long>), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (shared == MAP_FAILED)
+  {
+    std::cout << PHWHERE << " shared memory for the workers failed: " << std::strerror(errno)
+              << ", NOT forking, all events are processed in this process" << std::endl;
+    m_ForkWorkers = 0;
+    return;
+  }
+  m_ForkGoodEvents = new (shared) std::atomic<long>(0);
+  m_ForkParentPid = getpid();
+  // buffered output would be printed by every worker
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(nullptr);
+  m_Forked = true;
+  for (int iworker = 1; iworker < m_ForkWorkers; iworker++)
+  {
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+      std::cout << PHWHERE << " fork of worker " << iworker << " failed: "
+                << std::strerror(errno) << ", running with " << iworker
+                << " workers" << std::endl;
+      m_ForkWorkers = iworker;
+      break;
+    }
+    if (pid == 0)
+    {
+      m_WorkerId = iworker;
+      m_WorkerPids.clear();
+      // stop sharing the input files (and their offsets) with the main process
+      for (auto *syncman : SyncManagers)
+      {
+        for (auto *inman : syncman->GetInputManagers())
+        {
+          if (inman->ReopenAfterFork())
+          {
+            std::cout << PHWHERE << " worker " << m_WorkerId << ": " << inman->Name()
+                      << " could not reopen " << inman->FileName() << ", worker exits" << std::endl;
+            fflush(nullptr);
+            _exit(1);
+          }
+        }
+      }
+      // every worker writes its own files
+      for (auto *outman : OutputManager)
+      {
+        if (outman->EventsWritten() > 0)
+        {
+          std::cout << PHWHERE << " " << outman->Name() << " already wrote to "
+                    << outman->OutFileName() << " before the fork, this file is shared by all workers" << std::endl;
+        }
+        outman->outfileopen(WorkerFileName(outman->OutFileName(), m_WorkerId));
+      }
+      for (auto *histoman : HistoManager)
+      {
+        histoman->FileNameSuffix(std::format("_worker{:03}", m_WorkerId));
+      }
+      std::cout << "Fun4AllServer: worker " << m_WorkerId << " started, pid " << getpid() << std::endl;
+      return;
+    }
+    m_WorkerPids.push_back(pid);
+  }
+  std::cout << "Fun4AllServer: forked " << m_WorkerPids.size() << " workers after initialization, "
+            << "processing chunks of " << m_ForkChunkSize << " events in " << m_ForkWorkers
+            << " processes" << std::endl;
+}
+
+//_________________________________________________________________
+std::string Fun4AllServer::ForkHistoFileName(const Fun4AllHistoManager *histoman) const
+{
+  std::filesystem::path p = std::filesystem::temp_directory_path();
+  p /= std::format("{}_fork{}.root", histoman->Name(), m_ForkParentPid);
+  return p;
+}
+
+//_________________________________________________________________
+int Fun4AllServer::WaitForWorkers()
+{
+  int iret = 0;
+  for (unsigned int i = 0; i < m_WorkerPids.size(); i++)
+  {
+    int status = 0;
+    if (waitpid(m_WorkerPids[i], &status, 0) < 0)
+    {
+      std::cout << PHWHERE << " waiting for worker " << i + 1 << " failed: " << std::strerror(errno) << std::endl;
+      iret = -1;
+      continue;
+    }
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    {
+      std::cout << PHWHERE << " worker " << i + 1 << " (pid " << m_WorkerPids[i] << ") failed, status " << status << std::endl;
+      iret = -1;
+    }
+  }
+  m_WorkerPids.clear();
+  if (!OutputManager.empty())
+  {
+    std::cout << "Fun4AllServer: output of the workers is in the files with the _worker<N> suffix:" << std::endl;
+    for (auto *outman : OutputManager)
+    {
+      std::cout << outman->Name() << ": " << outman->OutFileName() << ", "
+                << WorkerFileName(outman->OutFileName(), 1) << ", ..." << std::endl;
+    }
+  }
   return iret;
 }
 
+//_________________________________________________________________
+void Fun4AllServer::MergeWorkerHistos()
+{
+  for (auto *histoman : HistoManager)
+  {
+    if (!histoman->ApplyFileRule())
+    {
+      // the macro saves these after End(), add the worker histograms to ours
+      for (int iworker = 1; iworker < m_ForkWorkers; iworker++)
+      {
+        std::string workerfile = WorkerFileName(ForkHistoFileName(histoman), iworker);
+        if (!std::filesystem::exists(workerfile))
+        {
+          continue;
+        }
+        if (histoman->AddHistosFromFile(workerfile))
+        {
+          std::cout << PHWHERE << " not all histograms of " << histoman->Name() << " from worker " << iworker
+                    << " could be added, keeping " << workerfile << std::endl;
+          continue;
+        }
+        std::filesystem::remove(workerfile);
+      }
+      continue;
+    }
+    // every segment written after an event number rollover has its own file,
+    // the workers write the same segments with their suffix
+    std::set<std::string> mergedfiles;
+    for (const auto &mainfile : histoman->ClosedFileNames())
+    {
+      if (!mergedfiles.insert(mainfile).second)
+      {
+        continue;
+      }
+      std::vector<std::string> workerfiles;
+      for (int iworker = 1; iworker < m_ForkWorkers; iworker++)
+      {
+        std::string workerfile = WorkerFileName(mainfile, iworker);
+        if (std::filesystem::exists(workerfile))
+        {
+          workerfiles.push_back(workerfile);
+        }
+      }
+      if (workerfiles.empty())
+      {
+        continue;
+      }
+      std::string mergedfile = mainfile + ".merging";
+      TFileMerger merger(false);
+      merger.SetPrintLevel(0);
+      merger.OutputFile(mergedfile.c_str(), "RECREATE");
+      merger.AddFile(mainfile.c_str());
+      for (const auto &workerfile : workerfiles)
+      {
+        merger.AddFile(workerfile.c_str());
+      }
+      if (!merger.Merge())
+      {
+        std::cout << PHWHERE << " merging of " << histoman->Name() << " worker histograms failed, keeping "
+                  << mainfile << " and the _worker files" << std::endl;
+        std::filesystem::remove(mergedfile);
+        continue;
+      }
+      std::filesystem::rename(mergedfile, mainfile);
+      for (const auto &workerfile : workerfiles)
+      {
+        std::filesystem::remove(workerfile);
+      }
+      std::cout << "Fun4AllServer: merged histograms of " << workerfiles.size() + 1 << " workers into " << mainfile << std::endl;
+    }
+  }
+}
+
 //_________________________________________________________________
 int Fun4AllServer::skip(const int nevnts)
 {
@@ -9,7 +9,10 @@
 
 #include <phool/PHTimer.h>
 
+#include <algorithm>
+#include <atomic>
 #include <deque>
+#include <future>
 #include <iostream>
 #include <map>
 #include <string>
@@ -21,6 +24,7 @@ class Fun4AllMemoryTracker;
 class Fun4AllSyncManager;
 class Fun4AllOutputManager;
 class PHCompositeNode;
+class PHNode;
 class PHTimeStamp;
 class SubsysReco;
 class TDirectory;
@@ -119,6 +123,60 @@ class Fun4AllServer : public Fun4AllBase
   int UpdateRunNode();
   void AddResetNodeName(const std::string &name) {ResetNodeList.emplace_back(name);}
 
+  /*!
+    \brief process events in nworkers processes which share the initialization.
+    After the first BeginRun (InitRun of all modules, geometry, field map,
+    calibrations) the process forks nworkers - 1 workers. The memory of the
+    initialization is shared copy-on-write. Events are handed out round robin
+    in chunks of chunksize events, every worker processes only its own chunks.
+    With a single DST input manager (and no event rejecting modules on it) the
+    chunks of the other workers are skipped without reading them, the first
+    event of each new input file is still read. Otherwise every worker reads
+    all events and discards the ones of the other workers. Right after the fork every worker reopens the
+    open input files (see Fun4AllInputManager::ReopenAfterFork), if an input
+    manager cannot do this the job is not forked. Workers write their output
+    and histogram files with a _worker<N> suffix. At End() the histogram files
+    of Fun4AllHistoManagers with file rule are merged into the file of the
+    main process, the histograms of all other managers are added to the
+    histograms of the main process, so the macro saves them as usual.
+    For run(nevents, true) the good events of all workers are counted, the
+    workers stop once there are nevents (up to one more per worker). They
+    stop at different events, no further run() is possible after this.
+    Only for input from files, modules which generate events (e.g. particle
+    generators) would produce the same events in all workers since their
+    random engines are copied. Jobs with a Fun4AllDummyInputManager are
+    therefore not forked. Files which modules open themselves before the
+    fork are shared by all workers.
+  */
+  void ForkAfterInit(const int nworkers, const int chunksize = 100);
+  //! 0 for the main process, 1..nworkers-1 for the forked workers
+  int WorkerId() const { return m_WorkerId; }
+  //! file name with worker suffix inserted before the extension
+  static std::string WorkerFileName(const std::string &filename, const int iworker);
+
+  /*!
+    \brief keep up to nevents events in flight in run() (default 1, serial).
+    The first consecutive modules on the TOP node which are flagged
+    SubsysReco::ThreadSafe() form the concurrent part. The modules before it
+    run serially after the event is read, then the event moves to its own node
+    tree and the concurrent part runs in a separate thread while the next
+    events are read. The modules after it and the output managers run serially
+    in input order once the oldest event is done. The event node trees mirror
+    the node tree after the first event: the objects under DST are cloned
+    (CloneMe()) and exchanged with the main node tree, all other PHObjects are
+    shared and must only be read (the run node objects are updated in place
+    when an input manager opens its next file while events are in flight).
+    Non PHObject nodes under DST and nodes created in process_event are not
+    supported, non PHObject nodes outside of DST (e.g. the PRDF Event) are not
+    visible to the concurrent modules. If the node tree cannot be mirrored or
+    no module is thread safe the job runs serially. The timers of the
+    concurrent modules are not filled, run(nevents, true) switches to serial
+    processing. Events in flight are only handled by run(), not by calling
+    process_event() directly.
+  */
+  void EventsInFlight(const int nevents) { m_EventsInFlight = std::max(nevents, 1); }
+  int EventsInFlight() const { return m_EventsInFlight; }
+
  protected:
   Fun4AllServer(const std::string &name = "Fun4AllServer");
   static int InitNodeTree(PHCompositeNode *topNode);
@@ -127,6 +185,35 @@ class Fun4AllServer : public Fun4AllBase
   int UpdateEventSelector(Fun4AllOutputManager *manager);
   int unregisterSubsystemsNow();
   int setRun(const int runno);
+  void ForkWorkers();
+  int SkipForkEvents(const int nevnts);
+  int WaitForWorkers();
+  void MergeWorkerHistos();
+  std::string ForkHistoFileName(const Fun4AllHistoManager *histoman) const;
+  int ProcessSubsystems(const unsigned ifirst, const unsigned ilast, int &eventbad);
+  int CheckRetCode(const unsigned icnt, int &eventbad);
+  void WriteEvent(const int eventbad, const std::string &currdir);
+  void ResetEventSubsystems(const unsigned ifirst, const unsigned ilast);
+  int process_event_in_flight(const std::string &currdir);
+  bool FindThreadSafeModules();
+  bool SetupEventsInFlight();
+  bool MirrorNodeTree(PHCompositeNode *from, PHCompositeNode *to, const bool indst, const unsigned islot);
+  int ProcessEventInFlight(const unsigned islot);
+  int RetireEventInFlight(const bool discard);
+  int DrainEventsInFlight(const bool discard = false);
+  void DeleteEventsInFlight();
+  // node tree of one event in flight
+  struct EventInFlight
+  {
+    PHCompositeNode *topNode{nullptr};
+    std::vector<PHNode *> dstNodes;     // own objects, same order as m_InFlightDstNodes
+    std::vector<PHNode *> sharedNodes;  // objects of the main node tree
+    std::vector<int> retcodes;
+    std::string error;  // exception in the thread of this event
+    std::future<int> done;
+    int eventnumber{0};
+    bool busy{false};
+  };
   static Fun4AllServer *__instance;
   TH1 *FrameWorkVars{nullptr};
   Fun4AllMemoryTracker *ffamemtracker{nullptr};
@@ -143,7 +230,22 @@ class Fun4AllServer : public Fun4AllBase
   int eventnumber{0};
   int eventcounter{0};
   int keep_db_connected{0};
-  
+  int m_ForkWorkers{0};
+  int m_ForkChunkSize{100};
+  int m_WorkerId{0};
+  bool m_Forked{false};
+  bool m_ForkPositionsDiverged{false};
+  long m_ForkEventIndex{0};
+  int m_ForkParentPid{0};
+  std::atomic<long> *m_ForkGoodEvents{nullptr};  // in memory shared by all workers
+  std::vector<int> m_WorkerPids;
+  int m_EventsInFlight{1};
+  unsigned m_ThreadSafeFirst{0};  // concurrent modules are [first, last)
+  unsigned m_ThreadSafeLast{0};
+  std::vector<EventInFlight> m_InFlightSlots;
+  std::deque<unsigned> m_InFlightQueue;  // slots in input order
+  std::vector<PHNode *> m_InFlightDstNodes;  // DST data nodes of the main node tree
+
   std::ios m_saved_cout_state{nullptr};
   std::vector<std::string> ComplaintList;
   std::vector<std::string> ResetNodeList {"DST"};
@@ -151,6 +253,9 @@ class Fun4AllServer : public Fun4AllBase
   std::vector<std::pair<SubsysReco *, PHCompositeNode *>> DeleteSubsystems;
   std::deque<std::pair<SubsysReco *, std::string>> NewSubsystems;
   std::vector<int> RetCodes;
+  // per event bookkeeping of the Subsystems, same index
+  std::vector<PHTimer *> SubsystemTimers;     // points into timer_map
+  std::vector<std::string> SubsystemTDirs;    // TDirectory of the subsystem
   std::vector<Fun4AllOutputManager *> OutputManager;
   std::vector<TDirectory *> TDirCollection;
   std::vector<Fun4AllHistoManager *> HistoManager;
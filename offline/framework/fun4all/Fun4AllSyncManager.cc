@@ -331,6 +331,19 @@ int Fun4AllSyncManager::skip(const int nevnts)
   return -1;
 }
 
+//_________________________________________________________________
+int Fun4AllSyncManager::SkipInFile(const int nevnts)
+{
+  // with more input managers the skipped events would have to be synced
+  if (m_InManager.size() != 1)
+  {
+    return 0;
+  }
+  int nskip = m_InManager.front()->SkipInFile(nevnts);
+  m_EventsTotal += nskip;
+  return nskip;
+}
+
 //_________________________________________________________________
 int Fun4AllSyncManager::fileopen(const std::string &managername, const std::string &filename)
 {
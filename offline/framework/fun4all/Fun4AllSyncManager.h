@@ -32,6 +32,10 @@ class Fun4AllSyncManager : public Fun4AllBase
   */
   int skip(const int nevnts = 0);
 
+  //! skip up to nevnts events of the current input file without reading them,
+  //! only possible with a single input manager. Returns the number of skipped events
+  int SkipInFile(const int nevnts);
+
   int fileopen(const std::string &managername, const std::string &filename);
   int fileclose(const std::string &managername = "NONE");
   int CurrentRun() { return m_CurrentRun; }
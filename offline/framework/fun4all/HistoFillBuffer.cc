@@ -0,0 +1,53 @@
+#include "HistoFillBuffer.h"
+
+#include <TH1.h>
+#include <TProfile.h>
+#include <TProfile2D.h>
+
+HistoFillBuffer::HistoFillBuffer(TH1 *histo, const std::size_t capacity)
+  : m_Histo(histo)
+  , m_Capacity(capacity)
+  , m_TwoCoordinates(histo->GetDimension() == 2 || histo->InheritsFrom(TProfile::Class()))
+{
+  if (m_Capacity > 0)
+  {
+    m_X.reserve(m_Capacity);
+    if (m_TwoCoordinates)
+    {
+      m_Y.reserve(m_Capacity);
+    }
+  }
+}
+
+bool HistoFillBuffer::Supported(const TH1 *histo)
+{
+  if (!histo)
+  {
+    return false;
+  }
+  if (histo->InheritsFrom(TProfile2D::Class()))
+  {
+    return false;
+  }
+  return histo->GetDimension() <= 2;
+}
+
+void HistoFillBuffer::Flush()
+{
+  if (m_X.empty())
+  {
+    return;
+  }
+  const double *w = m_W.empty() ? nullptr : m_W.data();
+  if (m_TwoCoordinates)
+  {
+    m_Histo->FillN(m_X.size(), m_X.data(), m_Y.data(), w);
+  }
+  else
+  {
+    m_Histo->FillN(m_X.size(), m_X.data(), w);
+  }
+  m_X.clear();
+  m_Y.clear();
+  m_W.clear();
+}
@@ -0,0 +1,94 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef FUN4ALL_HISTOFILLBUFFER_H
+#define FUN4ALL_HISTOFILLBUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+class TH1;
+
+//! collects the fills of one histogram in flat arrays and writes them with FillN
+/*!
+ * Supported are 1d histograms, 2d histograms and TProfiles. The Fill
+ * methods take the same arguments as the Fill of the histogram itself:
+ * Fill(x, w) for a 1d histogram, Fill(x, y) and Fill(x, y, w) for a 2d
+ * histogram or a TProfile. FillN gives the same bin contents and
+ * statistics as calling Fill for every entry.
+ *
+ * The buffer is flushed when it holds capacity fills, by Flush() and by
+ * its Fun4AllHistoManager before the histograms are saved or reset.
+ * A buffer is not thread safe. Threads which fill the same histogram use
+ * one buffer each, with capacity 0 (never flushed by the filling thread).
+ * Their Fun4AllHistoManager then flushes all its buffers from the main
+ * thread at the end of every event. This is only safe once the filling
+ * threads are joined, a module has to join its threads before it returns
+ * from process_event.
+ */
+class HistoFillBuffer
+{
+ public:
+  static constexpr std::size_t kDefaultCapacity = 4096;
+
+  explicit HistoFillBuffer(TH1 *histo, const std::size_t capacity = kDefaultCapacity);
+
+  //! histogram types which can be buffered
+  static bool Supported(const TH1 *histo);
+
+  //! 1d histograms only
+  void Fill(const double x) { add(x, 0., 1.); }
+
+  //! 1d histogram: x and weight, 2d histogram/TProfile: x and y
+  void Fill(const double x, const double y)
+  {
+    if (m_TwoCoordinates)
+    {
+      add(x, y, 1.);
+    }
+    else
+    {
+      add(x, 0., y);
+    }
+  }
+
+  //! 2d histograms/TProfiles only
+  void Fill(const double x, const double y, const double w) { add(x, y, w); }
+
+  //! write the buffered fills into the histogram
+  void Flush();
+
+  std::size_t size() const { return m_X.size(); }
+  TH1 *Histo() const { return m_Histo; }
+
+ private:
+  void add(const double x, const double y, const double w)
+  {
+    m_X.push_back(x);
+    if (m_TwoCoordinates)
+    {
+      m_Y.push_back(y);
+    }
+    // weights are only stored once a fill has a weight different from 1
+    if (w != 1. || !m_W.empty())
+    {
+      if (m_W.empty())
+      {
+        m_W.resize(m_X.size() - 1, 1.);
+      }
+      m_W.push_back(w);
+    }
+    if (m_X.size() == m_Capacity)
+    {
+      Flush();
+    }
+  }
+
+  TH1 *m_Histo{nullptr};
+  std::size_t m_Capacity{kDefaultCapacity};
+  bool m_TwoCoordinates{false};
+  std::vector<double> m_X;
+  std::vector<double> m_Y;
+  std::vector<double> m_W;
+};
+
+#endif
@@ -63,6 +63,15 @@ class SubsysReco : public Fun4AllBase
   /// For new rollover DSTs - we need to be able to update the Run Node before the End()
   virtual int UpdateRunNode(PHCompositeNode * /*topNode*/) { return 0; }
 
+  /** Declare that process_event() only works on the node tree it gets and
+      keeps no per event state in the module (no data members written per
+      event, no histogram fills, no TDirectory changes). Such modules can
+      process several events at the same time, see Fun4AllServer::EventsInFlight().
+      ResetEvent() is still called from the main thread.
+  */
+  void ThreadSafe(const bool b) { m_ThreadSafe = b; }
+  bool ThreadSafe() const { return m_ThreadSafe; }
+
 protected:
   /** ctor.
       @param name is the reference used inside the Fun4AllServer
@@ -71,6 +80,9 @@ protected:
     : Fun4AllBase(name)
   {
   }
+
+ private:
+  bool m_ThreadSafe{false};
 };
 
 #endif
@@ -72,6 +72,7 @@ int Fun4AllPrdfInputManager::fileopen(const std::string &filenam)
   int status = 0;
   m_EventIterator = new fileEventiterator(fname.c_str(), status);
   m_EventsThisFile = 0;
+  m_IteratorEvents = 0;
   if (status)
   {
     delete m_EventIterator;
@@ -124,6 +125,10 @@ readagain:
   else
   {
     m_Event = m_EventIterator->getNextEvent();
+    if (m_Event)
+    {
+      m_IteratorEvents++;
+    }
   }
   if (!m_Event || m_Event->getEvtType() == ENDRUNEVENT)
   {
@@ -232,6 +237,7 @@ int Fun4AllPrdfInputManager::PushBackEvents(const int i)
     }
     else
     {
+      m_IteratorEvents++;
       if (Verbosity() > 3)
       {
         std::cout << "Skipping evt no: " << m_Event->getEvtSequence() << std::endl;
@@ -244,6 +250,39 @@ int Fun4AllPrdfInputManager::PushBackEvents(const int i)
   return errorflag;
 }
 
+int Fun4AllPrdfInputManager::ReopenAfterFork()
+{
+  if (!m_EventIterator)
+  {
+    return 0;
+  }
+  delete m_EventIterator;
+  std::string fname = DBInterface::instance()->location(FileName());
+  int status = 0;
+  m_EventIterator = new fileEventiterator(fname.c_str(), status);
+  if (status)
+  {
+    delete m_EventIterator;
+    m_EventIterator = nullptr;
+    IsOpen(0);
+    std::cout << PHWHERE << Name() << ": could not reopen file " << fname << std::endl;
+    return -1;
+  }
+  // prdfs can only be read sequentially, read up to the same position again
+  for (int i = 0; i < m_IteratorEvents; i++)
+  {
+    Event *evt = m_EventIterator->getNextEvent();
+    if (!evt)
+    {
+      std::cout << PHWHERE << Name() << ": " << fname << " ended after " << i
+                << " events while going back to event " << m_IteratorEvents << std::endl;
+      return -1;
+    }
+    delete evt;
+  }
+  return 0;
+}
+
 int Fun4AllPrdfInputManager::GetSyncObject(SyncObject **mastersync)
 {
   // here we copy the sync object from the current file to the
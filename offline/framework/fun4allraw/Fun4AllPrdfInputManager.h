@@ -30,11 +30,14 @@ class Fun4AllPrdfInputManager : public Fun4AllInputManager
   int SyncIt(const SyncObject *mastersync) override;
   int HasSyncObject() const override { return 1; }
   std::string GetString(const std::string &what) const override;
+  bool CanReopenAfterFork() const override { return true; }
+  int ReopenAfterFork() override;
 
  private:
   int m_Segment = -999;
   int m_EventsTotal = 0;
   int m_EventsThisFile = 0;
+  int m_IteratorEvents = 0;  // events read from the current file, including skipped ones
   PHCompositeNode *m_topNode = nullptr;
   Event *m_Event = nullptr;
   Event *m_SaveEvent = nullptr;
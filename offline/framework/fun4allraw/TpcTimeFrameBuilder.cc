@@ -177,6 +177,10 @@ TpcTimeFrameBuilder::~TpcTimeFrameBuilder()
       timeFrameEntry.second.pop_back();
     }
   }
+  for (TpcRawHitv3* hit : m_rawHitPool)
+  {
+    delete hit;
+  }
 
   delete m_packetTimer;
 
@@ -266,7 +270,7 @@ std::vector<TpcRawHit*>& TpcTimeFrameBuilder::getTimeFrame(const uint64_t& gtm_b
       h_GTMClockDiff_Dropped->Fill(int64_t(it->first) - int64_t(bclk_rollover_corrected));
       for (const auto& hit : it->second)
       {
-        delete hit;
+        recycle_raw_hit(hit);
       }
       it = m_timeFrameMap.erase(it);
     }
@@ -332,6 +336,30 @@ std::vector<TpcRawHit*>& TpcTimeFrameBuilder::getTimeFrame(const uint64_t& gtm_b
   return empty;
 }
 
+TpcRawHitv3* TpcTimeFrameBuilder::get_raw_hit()
+{
+  if (m_rawHitPool.empty())
+  {
+    return new TpcRawHitv3();
+  }
+  TpcRawHitv3* hit = m_rawHitPool.back();
+  m_rawHitPool.pop_back();
+  return hit;
+}
+
+void TpcTimeFrameBuilder::recycle_raw_hit(TpcRawHit* hit)
+{
+  // all hits in m_timeFrameMap are TpcRawHitv3 from get_raw_hit()
+  if (m_rawHitPool.size() >= kMaxRawHitPoolSize)
+  {
+    delete hit;
+    return;
+  }
+  // the ADC data is usually already moved into the output container, this drops the rest
+  hit->Clear("");
+  m_rawHitPool.push_back(static_cast<TpcRawHitv3*>(hit));  // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+}
+
 void TpcTimeFrameBuilder::CleanupUsedPackets(const uint64_t& bclk)
 {
   if (m_verbosity > 2)
@@ -365,7 +393,7 @@ void TpcTimeFrameBuilder::CleanupUsedPackets(const uint64_t& bclk)
     {
       while (!it->second.empty())
       {
-        delete it->second.back();
+        recycle_raw_hit(it->second.back());
         it->second.pop_back();
       }
       m_timeFrameMap.erase(it);
@@ -384,7 +412,7 @@ void TpcTimeFrameBuilder::CleanupUsedPackets(const uint64_t& bclk)
       while (!it->second.empty())
       {
         m_hFEEDataStream->Fill(it->second.back()->get_fee(), "HitUnusedBeforeCleanup", 1);
-        delete it->second.back();
+        recycle_raw_hit(it->second.back());
         it->second.pop_back();
         ++count;
       }
@@ -598,10 +626,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
 
       if (fee_id < MAX_FEECOUNT)
       {
-        for (const uint16_t& i : dma_word_data.data)
-        {
-          m_feeData[fee_id].push_back(i);
-        }
+        m_feeData[fee_id].append(dma_word_data.data, DAM_DMA_WORD_LENGTH - 1);
         m_hNorm->Fill("DMA_WORD_FEE", 1);
 
         // immediate fee buffer processing to reduce memory consuption
@@ -642,7 +667,7 @@ int TpcTimeFrameBuilder::ProcessPacket(Packet* packet)
 
       while (!timeframe.second.empty())
       {
-        delete timeframe.second.back();
+        recycle_raw_hit(timeframe.second.back());
         timeframe.second.pop_back();
       }
     }
@@ -665,7 +690,7 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
   }
 
   assert(fee < m_feeData.size());
-  std::deque<uint16_t>& data_buffer = m_feeData[fee];
+  fee_data_buffer& data_buffer = m_feeData[fee];
 
   while (HEADER_LENGTH <= data_buffer.size())
   {
@@ -746,7 +771,7 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
     {
       process_fee_data_waveform(fee, data_buffer);
     }
-    data_buffer.erase(data_buffer.begin(), data_buffer.begin() + pkt_length + 1);
+    data_buffer.pop_front(pkt_length + 1);
     m_hFEEDataStream->Fill(fee, "WordValid", pkt_length + 1);
 
   }  //     while (HEADER_LENGTH < data_buffer.size())
@@ -754,7 +779,7 @@ int TpcTimeFrameBuilder::process_fee_data(unsigned int fee)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
-void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std::deque<uint16_t>& data_buffer)
+void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, const fee_data_buffer& data_buffer)
 {
   const uint16_t& pkt_length = data_buffer[0];
 
@@ -915,8 +940,7 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
 
     // Format is (N sample) (start time), (1st sample)... (Nth sample)
     size_t pos = HEADER_LENGTH;
-    std::deque<uint16_t>::const_iterator data_buffer_iterator = data_buffer.cbegin();
-    std::advance(data_buffer_iterator, pos);
+    const uint16_t* data_buffer_iterator = data_buffer.data() + pos;
     while (pos + 2 < pkt_length)
     {
       const uint16_t& nsamp = *data_buffer_iterator;
@@ -952,17 +976,13 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
       }
 
       const unsigned int fee_sampa_address = fee * MAX_SAMPA + payload.sampa_address;
-      std::vector<uint16_t> adc(nsamp);
+      std::vector<uint16_t> adc(data_buffer_iterator, data_buffer_iterator + nsamp);
       for (int j = 0; j < nsamp; j++)
       {
-        const uint16_t& adc_value = *data_buffer_iterator;
-
-        adc[j] = adc_value;
-        m_hFEESAMPAADC->Fill(start_t + j, fee_sampa_address, adc_value);
-
-        ++pos;
-        ++data_buffer_iterator;  // data_buffer[pos++];
+        m_hFEESAMPAADC->Fill(start_t + j, fee_sampa_address, adc[j]);
       }
+      pos += nsamp;
+      data_buffer_iterator += nsamp;
       payload.waveforms.emplace_back(start_t, std::move(adc));
 
       //   // an exception to deal with the last sample that is missing in the current hit format
@@ -983,7 +1003,7 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
     // valid packet in the buffer, create a new hit
     if (payload.type != TpcTimeFrameBuilder::BcoMatchingInformation::HEARTBEAT_T)
     {
-      TpcRawHitv3* hit = new TpcRawHitv3();
+      TpcRawHitv3* hit = get_raw_hit();
       m_timeFrameMap[payload.gtm_bco].push_back(hit);
 
       hit->set_bco(payload.bx_timestamp);
@@ -1006,7 +1026,7 @@ void TpcTimeFrameBuilder::process_fee_data_waveform(const unsigned int& fee, std
   return;
 }
 
-void TpcTimeFrameBuilder::process_fee_data_digital_current(const unsigned int& fee, std::deque<uint16_t>& data_buffer)
+void TpcTimeFrameBuilder::process_fee_data_digital_current(const unsigned int& fee, const fee_data_buffer& data_buffer)
 {
   if (m_verbosity > 2)
   {
@@ -1258,10 +1278,10 @@ uint16_t TpcTimeFrameBuilder::reverseBits(const uint16_t x) const
 
 std::pair<uint16_t, uint16_t> TpcTimeFrameBuilder::crc16_parity(const uint32_t fee, const uint16_t l) const
 {
-  const std::deque<uint16_t>& data_buffer = m_feeData[fee];
+  const fee_data_buffer& data_buffer = m_feeData[fee];
   assert(l < data_buffer.size());
 
-  std::deque<uint16_t>::const_iterator it = data_buffer.begin();
+  const uint16_t* it = data_buffer.data();
 
   uint16_t crc = 0xffffU;
   uint16_t data_parity = 0U;
@@ -3,7 +3,6 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <deque>
 #include <functional>
 #include <iostream>
 #include <limits>
@@ -18,6 +17,7 @@
 
 class Packet;
 class TpcRawHit;
+class TpcRawHitv3;
 class PHTimer;
 class TH1;
 class TH2;
@@ -79,10 +79,54 @@ class TpcTimeFrameBuilder
     uint16_t data[DAM_DMA_WORD_LENGTH - 1] = {0};
   };
 
+  //! FIFO of the data words of one FEE in contiguous memory
+  /*!
+   * words are appended at the back and consumed from the front. Consumed
+   * words are only dropped when the buffer is compacted in append(), which
+   * moves the remaining (at most one partial FEE packet) words to the front.
+   * Unlike a deque, a whole FEE packet can be read through a plain pointer.
+   */
+  class fee_data_buffer
+  {
+   public:
+    size_t size() const { return m_data.size() - m_begin; }
+    const uint16_t &operator[](const size_t i) const { return m_data[m_begin + i]; }
+    const uint16_t *data() const { return m_data.data() + m_begin; }
+
+    void append(const uint16_t *words, const size_t n)
+    {
+      if (m_begin > 0 && m_begin >= m_data.size() / 2)
+      {
+        m_data.erase(m_data.begin(), m_data.begin() + m_begin);
+        m_begin = 0;
+      }
+      m_data.insert(m_data.end(), words, words + n);
+    }
+
+    void pop_front(const size_t n = 1)
+    {
+      m_begin += n;
+      if (m_begin >= m_data.size())
+      {
+        m_data.clear();
+        m_begin = 0;
+      }
+    }
+
+   private:
+    std::vector<uint16_t> m_data;
+    size_t m_begin = 0;
+  };
+
   int decode_gtm_data(const dma_word &gtm_word);
   int process_fee_data(unsigned int fee_id);
-  void process_fee_data_waveform(const unsigned int & fee_id, std::deque<uint16_t>& data_buffer);
-  void process_fee_data_digital_current(const unsigned int & fee_id, std::deque<uint16_t>& data_buffer);
+  void process_fee_data_waveform(const unsigned int & fee_id, const fee_data_buffer& data_buffer);
+  void process_fee_data_digital_current(const unsigned int & fee_id, const fee_data_buffer& data_buffer);
+
+  //! TpcRawHitv3 from the pool of recycled hits, allocated if the pool is empty
+  TpcRawHitv3 *get_raw_hit();
+  //! return a hit of m_timeFrameMap to the pool
+  void recycle_raw_hit(TpcRawHit *hit);
 
   struct gtm_payload
   {
@@ -369,7 +413,7 @@ class TpcTimeFrameBuilder
   };  //   class BcoMatchingInformation
 
  private:
-  std::vector<std::deque<uint16_t>> m_feeData;
+  std::vector<fee_data_buffer> m_feeData;
 
   int m_verbosity = 0;
   int m_packet_id = 0;
@@ -384,6 +428,10 @@ class TpcTimeFrameBuilder
   static const size_t kMaxRawHitLimit = 10000;  // 10k hits per event > 256ch/fee * 26fee
   std::queue<uint64_t> m_UsedTimeFrameSet;
 
+  //! recycled hits, all hits of m_timeFrameMap are created by this builder and returned here
+  std::vector<TpcRawHitv3 *> m_rawHitPool;
+  static const size_t kMaxRawHitPoolSize = 4 * kMaxRawHitLimit;
+
   //! fast skip mode when searching for particular GL1 BCO over long segment of files
   bool m_fastBCOSkip = false;
 
@@ -24,7 +24,21 @@ class PHIODataNode : public PHDataNode<T>
   PHIODataNode(T *, const std::string &);
   PHIODataNode(T *, const std::string &, const std::string &);
   PHIODataNode(T *, const int, const std::string &);
-  virtual ~PHIODataNode() = default;
+  virtual ~PHIODataNode();
+  //! data of this node, for nodes of a lazy reading PHNodeIOManager the
+  //! object is read from file at the first access in an event
+  T *getData()
+  {
+    lazyRead();
+    return this->data.data;
+  }
+  void lazyRead()
+  {
+    if (m_LazyIOManager)
+    {
+      m_LazyIOManager->readLazyBranch(m_LazyIndex);
+    }
+  }
   typedef PHTypedNodeIterator<T> iterator;
   void BufferSize(int size) { buffersize = size; }
   void SplitLevel(int split) { splitlevel = split; }
@@ -34,8 +48,20 @@ class PHIODataNode : public PHDataNode<T>
   PHIODataNode() = delete;
   int buffersize{32000};
   int splitlevel{0};
+  // set by a lazy reading PHNodeIOManager
+  PHNodeIOManager *m_LazyIOManager{nullptr};
+  int m_LazyIndex{-1};
 };
 
+template <class T>
+PHIODataNode<T>::~PHIODataNode()
+{
+  if (m_LazyIOManager)
+  {
+    m_LazyIOManager->forgetLazyNode(m_LazyIndex);
+  }
+}
+
 template <class T>
 PHIODataNode<T>::PHIODataNode(T *d, const std::string &n)
   : PHDataNode<T>(d, n)
@@ -70,6 +96,8 @@ bool PHIODataNode<T>::write(PHIOManager *IOManager, const std::string &path)
 {
   if (this->persistent)
   {
+    // an object which was not accessed yet in a lazy read event has to be read first
+    lazyRead();
     PHNodeIOManager *np = dynamic_cast<PHNodeIOManager *>(IOManager);
     if (np)
     {
@@ -57,6 +57,14 @@ PHNodeIOManager::PHNodeIOManager(const std::string& f, const PHAccessType a,
 
 PHNodeIOManager::~PHNodeIOManager()
 {
+  // nodes survive their input file, they must not read from us anymore
+  for (auto& lazy : m_LazyBranches)
+  {
+    if (lazy.node && lazy.node->m_LazyIOManager == this)
+    {
+      lazy.node->m_LazyIOManager = nullptr;
+    }
+  }
   closeFile();
   delete file;
 }
@@ -274,6 +282,15 @@ PHNodeIOManager::getBranchClassName(TBranch* branch)
   exit(1);  // the compiler does not know gSystem->Exit() quits, needs exit to avoid warning
 }
 
+size_t PHNodeIOManager::GetEventsInFile() const
+{
+  if (!tree)
+  {
+    return 0;
+  }
+  return static_cast<size_t>(tree->GetEntries());
+}
+
 bool PHNodeIOManager::readEventFromFile(size_t requestedEvent)
 {
   // Se non c'e niente, non possiamo fare niente.  Logisch, n'est ce
@@ -299,7 +316,25 @@ bool PHNodeIOManager::readEventFromFile(size_t requestedEvent)
     tree->SetCacheSize(m_cacheSize);
   }
 
-  if (requestedEvent)
+  if (m_LazyRead)
+  {
+    // only advance the event, the branches are read in loadLazyBranch()
+    // when their objects are accessed
+    int64_t entry = (requestedEvent) ? requestedEvent : eventNumber++;
+    bytesRead = 0;
+    if (entry < tree->GetEntries())
+    {
+      if (requestedEvent)
+      {
+        eventNumber = requestedEvent + 1;
+      }
+      m_LazyEntry = entry;
+      ++m_LazyGeneration;
+      ++m_LazyEvents;
+      bytesRead = 1;
+    }
+  }
+  else if (requestedEvent)
   {
     bytesRead = tree->GetEvent(requestedEvent);
     if (bytesRead)
@@ -327,6 +362,37 @@ bool PHNodeIOManager::readEventFromFile(size_t requestedEvent)
   return true;
 }
 
+void PHNodeIOManager::loadLazyBranch(const int index)
+{
+  LazyBranch &lazy = m_LazyBranches[index];
+  lazy.generation = m_LazyGeneration;
+  if (m_LazyEntry < 0)
+  {
+    return;
+  }
+  // same gDirectory/gFile dance as in readEventFromFile
+  std::string currdir = gDirectory->GetPath();
+  TFile* file_ptr = gFile;
+  file->cd();
+  int bytesRead = lazy.branch->GetEntry(m_LazyEntry);
+  gFile = file_ptr;
+  gROOT->cd(currdir.c_str());
+  if (bytesRead == -1)
+  {
+    std::cout << PHWHERE << "Error: Input TTree corrupt, exiting now" << std::endl;
+    exit(1);
+  }
+  ++lazy.nreads;
+}
+
+void PHNodeIOManager::LazyReadStatistics(std::map<std::string, uint64_t>& nreads) const
+{
+  for (const auto& lazy : m_LazyBranches)
+  {
+    nreads[lazy.branch->GetName()] += lazy.nreads;
+  }
+}
+
 int PHNodeIOManager::readSpecific(size_t requestedEvent, const std::string& objectName)
 {
   // objectName should be one of the valid branch name of the "T" TTree, and
@@ -465,7 +531,7 @@ PHNodeIOManager::reconstructNodeTree(PHCompositeNode* topNode)
     }
     else
     {
-      TObject* oldobject = newIODataNode->getData();
+      TObject* oldobject = newIODataNode->PHDataNode<TObject>::getData();
       std::string oldclass = oldobject->ClassName();
       if (oldclass != branchClassName)
       {
@@ -498,6 +564,12 @@ PHNodeIOManager::reconstructNodeTree(PHCompositeNode* topNode)
       newIODataNode->setObjectType("PHObject");
     }
     thisBranch->SetAddress(&(newIODataNode->data));
+    if (m_LazyRead)
+    {
+      newIODataNode->m_LazyIOManager = this;
+      newIODataNode->m_LazyIndex = m_LazyBranches.size();
+      m_LazyBranches.push_back({thisBranch, newIODataNode});
+    }
     for (j = 1; j < splitvec.size() - 1; j++)
     {
       nodeIter.cd("..");
@@ -618,6 +690,15 @@ bool PHNodeIOManager::NodeExist(const std::string& nodename)
   return false;
 }
 
+void PHNodeIOManager::AutoFlush(const int64_t autoflush)
+{
+  m_AutoFlush = autoflush;
+  if (tree && (accessMode == PHWrite || accessMode == PHUpdate) && m_AutoFlush != 0)
+  {
+    tree->SetAutoFlush(m_AutoFlush);
+  }
+}
+
 void PHNodeIOManager::DisableReadCache()
 {
   if (file)
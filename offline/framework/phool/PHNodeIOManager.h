@@ -14,8 +14,11 @@
 #include <limits>
 #include <map>
 #include <string>
+#include <vector>
 
 class PHCompositeNode;
+template <typename T>
+class PHIODataNode;
 class TBranch;
 class TFile;
 class TObject;
@@ -46,6 +49,8 @@ class PHNodeIOManager : public PHIOManager
   uint64_t GetBytesWritten();
   uint64_t GetFileSize();
   std::map<std::string, TBranch *> *GetBranchMap();
+  //! number of events in the open input file, 0 before the first read
+  size_t GetEventsInFile() const;
 
   bool write(TObject **, const std::string &, int nodebuffersize, int nodesplitlevel);
   bool NodeExist(const std::string &nodename);
@@ -56,10 +61,45 @@ class PHNodeIOManager : public PHIOManager
   int BufferSize() const { return buffersize; }
   int CacheSize() const { return m_cacheSize; }
   void CacheSize(uint64_t size) { m_cacheSize = size;}
+  //! TTree::SetAutoFlush of the output tree, basket sizes are optimized at the first flush
+  //! >0: number of entries, <0: number of bytes, 0: ROOT default
+  void AutoFlush(const int64_t autoflush);
   
   void DisableReadCache();
 
+  //! lazy read mode, has to be set before the first read.
+  //! read() only advances the event, the object of a node is read from its
+  //! branch when it is accessed with findNode::getClass (or written out)
+  //! the first time in this event. Modules have to get their objects from
+  //! the node tree every event, a pointer kept from a previous event is
+  //! not filled.
+  void LazyRead(const bool b) { m_LazyRead = b; }
+  bool LazyRead() const { return m_LazyRead; }
+  //! read the object of a lazy node for the current event, if not yet done
+  void readLazyBranch(const int index)
+  {
+    if (m_LazyBranches[index].generation != m_LazyGeneration)
+    {
+      loadLazyBranch(index);
+    }
+  }
+  //! the lazy node is deleted, do not touch it anymore
+  void forgetLazyNode(const int index) { m_LazyBranches[index].node = nullptr; }
+  //! number of events and number of times each branch was read in lazy mode
+  uint64_t LazyEvents() const { return m_LazyEvents; }
+  void LazyReadStatistics(std::map<std::string, uint64_t> &nreads) const;
+
 private:
+  struct LazyBranch
+  {
+    TBranch *branch{nullptr};
+    PHIODataNode<TObject> *node{nullptr};
+    uint64_t generation{0};  // event generation the object was last read
+    uint64_t nreads{0};
+  };
+
+  void loadLazyBranch(const int index);
+
   int FillBranchMap();
   PHCompositeNode *reconstructNodeTree(PHCompositeNode *);
   bool readEventFromFile(size_t requestedEvent);
@@ -69,6 +109,7 @@ private:
   TTree *tree{nullptr};
   std::string TreeName{"T"};
   uint64_t m_cacheSize = std::numeric_limits<uint64_t>::max();
+  int64_t m_AutoFlush{0};
   int accessMode{PHReadOnly};
   int m_CompressionSetting{505};  // ZSTD
   int isFunctionalFlag{0};        // flag to tell if that object initialized properly
@@ -76,6 +117,12 @@ private:
   int splitlevel{std::numeric_limits<int>::min()};
   std::map<std::string, TBranch *> fBranches;
   std::map<std::string, bool> objectToRead;
+
+  bool m_LazyRead{false};
+  int64_t m_LazyEntry{-1};
+  uint64_t m_LazyGeneration{1};  // incremented for every read event
+  uint64_t m_LazyEvents{0};
+  std::vector<LazyBranch> m_LazyBranches;
 };
 
 #endif
@@ -22,6 +22,12 @@ namespace findNode
     {
       return nullptr;
     }
+    // objects of lazily read PHIODataNodes are read from file at the first access
+    // in an event. Only real PHIODataNodes have the lazy read members
+    if (FoundNode->getType() == "PHIODataNode")
+    {
+      static_cast<PHIODataNode<TObject> *>(FoundNode)->lazyRead();
+    }
     // first test if it is a PHDataNode
     PHDataNode<T> *DNode = dynamic_cast<PHDataNode<T> *>(FoundNode);
     if (DNode)
@@ -41,7 +47,7 @@ namespace findNode
     PHIODataNode<TObject> *IONode = static_cast<PHIODataNode<TObject> *>(FoundNode);
     if (IONode)
     {
-      T *object = dynamic_cast<T *>(IONode->getData());
+      T *object = dynamic_cast<T *>(IONode->PHDataNode<TObject>::getData());
       if (!object)
       {
         return nullptr;
@@ -0,0 +1,163 @@
+#include "CaloWaveformBlock.h"
+
+#include <algorithm>
+#include <bit>
+
+// byte stream layout:
+//   varint  number of channels
+//   per channel:
+//     varint  number of samples n
+//     (n > 0) varint zigzag(first sample), uint8 bit width w,
+//             n-1 zigzag encoded differences, w bits each, least significant
+//             bit first, padded to a full byte
+
+namespace
+{
+  uint32_t zigzag(const int32_t value)
+  {
+    return (static_cast<uint32_t>(value) << 1U) ^ static_cast<uint32_t>(value >> 31);
+  }
+
+  int32_t unzigzag(const uint32_t value)
+  {
+    return static_cast<int32_t>(value >> 1U) ^ -static_cast<int32_t>(value & 1U);
+  }
+
+  void put_varint(std::vector<uint8_t> &buffer, uint32_t value)
+  {
+    while (value >= 0x80U)
+    {
+      buffer.push_back((value & 0x7FU) | 0x80U);
+      value >>= 7U;
+    }
+    buffer.push_back(value);
+  }
+
+  bool get_varint(const std::vector<uint8_t> &buffer, std::size_t &pos, uint32_t &value)
+  {
+    value = 0;
+    for (unsigned int shift = 0; shift < 35; shift += 7)
+    {
+      if (pos >= buffer.size())
+      {
+        return false;
+      }
+      const uint8_t byte = buffer[pos++];
+      value |= static_cast<uint32_t>(byte & 0x7FU) << shift;
+      if (!(byte & 0x80U))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+}  // namespace
+
+void CaloWaveformBlock::encode(std::vector<uint8_t> &buffer) const
+{
+  buffer.clear();
+  // most waveforms need well below one byte per sample
+  buffer.reserve(m_samples.size() + 4 * size() + 5);
+  put_varint(buffer, size());
+  for (unsigned int ch = 0; ch < size(); ch++)
+  {
+    const std::span<const int16_t> samples = channel(ch);
+    put_varint(buffer, samples.size());
+    if (samples.empty())
+    {
+      continue;
+    }
+    put_varint(buffer, zigzag(samples[0]));
+    uint32_t maxdelta = 0;
+    for (std::size_t i = 1; i < samples.size(); i++)
+    {
+      maxdelta = std::max(maxdelta, zigzag(samples[i] - samples[i - 1]));
+    }
+    const unsigned int width = std::bit_width(maxdelta);
+    buffer.push_back(width);
+    if (width == 0)
+    {
+      continue;
+    }
+    uint64_t bits = 0;
+    unsigned int nbits = 0;
+    for (std::size_t i = 1; i < samples.size(); i++)
+    {
+      bits |= static_cast<uint64_t>(zigzag(samples[i] - samples[i - 1])) << nbits;
+      nbits += width;
+      while (nbits >= 8)
+      {
+        buffer.push_back(bits & 0xFFU);
+        bits >>= 8U;
+        nbits -= 8;
+      }
+    }
+    if (nbits > 0)
+    {
+      buffer.push_back(bits & 0xFFU);
+    }
+  }
+}
+
+bool CaloWaveformBlock::decode(const std::vector<uint8_t> &buffer)
+{
+  clear();
+  std::size_t pos = 0;
+  uint32_t nchannels = 0;
+  if (!get_varint(buffer, pos, nchannels) || nchannels > buffer.size())
+  {
+    return false;
+  }
+  m_offsets.reserve(nchannels + 1);
+  for (uint32_t ch = 0; ch < nchannels; ch++)
+  {
+    uint32_t nsamples = 0;
+    if (!get_varint(buffer, pos, nsamples) || nsamples > kMaxSamples)
+    {
+      clear();
+      return false;
+    }
+    if (nsamples == 0)
+    {
+      add_channel(0);
+      continue;
+    }
+    uint32_t first = 0;
+    if (!get_varint(buffer, pos, first) || pos >= buffer.size())
+    {
+      clear();
+      return false;
+    }
+    const unsigned int width = buffer[pos++];
+    // differences of int16_t values need at most 17 bits
+    if (width > 17 || (static_cast<std::size_t>(nsamples - 1) * width + 7) / 8 > buffer.size() - pos)
+    {
+      clear();
+      return false;
+    }
+    int16_t *samples = add_channel(nsamples);
+    int32_t value = unzigzag(first);
+    samples[0] = value;
+    const uint32_t mask = (1U << width) - 1;
+    uint64_t bits = 0;
+    unsigned int nbits = 0;
+    for (uint32_t i = 1; i < nsamples; i++)
+    {
+      while (nbits < width)
+      {
+        bits |= static_cast<uint64_t>(buffer[pos++]) << nbits;
+        nbits += 8;
+      }
+      value += unzigzag(bits & mask);
+      bits >>= width;
+      nbits -= width;
+      samples[i] = value;
+    }
+  }
+  if (pos != buffer.size())
+  {
+    clear();
+    return false;
+  }
+  return true;
+}
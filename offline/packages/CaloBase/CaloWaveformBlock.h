@@ -0,0 +1,92 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef CALOBASE_CALOWAVEFORMBLOCK_H
+#define CALOBASE_CALOWAVEFORMBLOCK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//! waveforms of many calorimeter channels in one contiguous buffer
+/*!
+ * The samples of all channels are stored back to back as int16_t (the
+ * sample type of TowerInfov3/v4, which holds the 14 bit ADCs and the -1
+ * marker of missing packets), channel i occupies [offset(i), offset(i+1)).
+ * Channels can have different lengths, e.g. 2 samples (pre/post) for zero
+ * suppressed channels. channel(i) returns a view without copies.
+ *
+ * clear() keeps the allocated memory, a block which is reused event by
+ * event does not allocate once it has seen its largest event.
+ *
+ * encode()/decode() convert the block to a compact byte stream: per
+ * channel the first sample followed by the zigzag encoded differences of
+ * consecutive samples, bit packed with the smallest width which holds all
+ * differences of this channel.
+ */
+class CaloWaveformBlock
+{
+ public:
+  //! maximum number of samples per channel accepted by decode()
+  static constexpr uint32_t kMaxSamples = 0xFFFFU;
+
+  //! remove all channels, keeps the allocated memory
+  void clear()
+  {
+    m_samples.clear();
+    m_offsets.resize(1);
+  }
+
+  void reserve(const unsigned int nchannels, const unsigned int nsamples)
+  {
+    m_offsets.reserve(nchannels + 1);
+    m_samples.reserve(static_cast<std::size_t>(nchannels) * nsamples);
+  }
+
+  //! append a channel with nsamples samples, returns the samples to fill
+  //! the pointer is invalidated by the next add_channel call
+  int16_t *add_channel(const unsigned int nsamples)
+  {
+    const std::size_t offset = m_samples.size();
+    m_samples.resize(offset + nsamples);
+    m_offsets.push_back(m_samples.size());
+    return m_samples.data() + offset;
+  }
+
+  //! append a channel with nsamples samples of the same value
+  void add_channel(const unsigned int nsamples, const int16_t value)
+  {
+    m_samples.insert(m_samples.end(), nsamples, value);
+    m_offsets.push_back(m_samples.size());
+  }
+
+  //! number of channels
+  unsigned int size() const { return m_offsets.size() - 1; }
+
+  bool empty() const { return size() == 0; }
+
+  //! number of samples of channel
+  unsigned int nsamples(const unsigned int ch) const { return m_offsets[ch + 1] - m_offsets[ch]; }
+
+  //! samples of channel
+  std::span<const int16_t> channel(const unsigned int ch) const
+  {
+    return {m_samples.data() + m_offsets[ch], nsamples(ch)};
+  }
+
+  //! all samples, in channel order
+  const std::vector<int16_t> &samples() const { return m_samples; }
+
+  //! replace buffer content by the delta and bit packed encoding of this block
+  void encode(std::vector<uint8_t> &buffer) const;
+
+  //! replace this block by the content of an encode() buffer
+  //! returns false and leaves the block empty if the buffer is corrupted
+  bool decode(const std::vector<uint8_t> &buffer);
+
+ private:
+  std::vector<int16_t> m_samples;
+  std::vector<uint32_t> m_offsets{0};
+};
+
+#endif
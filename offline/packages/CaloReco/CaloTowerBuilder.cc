@@ -35,6 +35,7 @@
 #include <TSystem.h>
 
 #include <climits>
+#include <cstdint>
 #include <iostream>  // for operator<<, endl, basic...
 #include <memory>    // for allocator_traits<>::val...
 #include <variant>
@@ -260,7 +261,7 @@ int CaloTowerBuilder::process_sim()
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
-int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::vector<float>> &waveforms)
+int CaloTowerBuilder::process_data(PHCompositeNode *topNode, CaloWaveformBlock &waveforms)
 {
   std::variant<CaloPacketContainer *, Event *> event;
   if (m_UseOfflinePacketFlag)
@@ -316,13 +317,7 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
           {
             continue;
           }
-          std::vector<float> waveform;
-          waveform.reserve(m_nzerosuppsamples);
-          for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-          {
-            waveform.push_back(-1);
-          }
-          waveforms.push_back(waveform);
+          waveforms.add_channel(m_nzerosuppsamples, -1);
         }
         return Fun4AllReturnCodes::EVENT_OK;
       }
@@ -357,36 +352,26 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
               for (int iskip = 0; iskip < 64; iskip++)
               {
                 n_pad_skip_mask++;
-                std::vector<float> waveform;
-                waveform.reserve(m_nsamples);
-
-                for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-                {
-                  waveform.push_back(0);
-                }
-                waveforms.push_back(waveform);
-                waveform.clear();
+                waveforms.add_channel(m_nzerosuppsamples, 0);
               }
             }
           }
         }
 
-        std::vector<float> waveform;
-        waveform.reserve(m_nsamples);
         if (packet->iValue(channel, "SUPPRESSED"))
         {
-          waveform.push_back(packet->iValue(channel, "PRE"));
-          waveform.push_back(packet->iValue(channel, "POST"));
+          int16_t *waveform = waveforms.add_channel(2);
+          waveform[0] = packet->iValue(channel, "PRE");
+          waveform[1] = packet->iValue(channel, "POST");
         }
         else
         {
+          int16_t *waveform = waveforms.add_channel(m_nsamples);
           for (int samp = 0; samp < m_nsamples; samp++)
           {
-            waveform.push_back(packet->iValue(samp, channel));
+            waveform[samp] = packet->iValue(samp, channel);
           }
         }
-        waveforms.push_back(waveform);
-        waveform.clear();
       }
 
       int nch_padded = nchannels;
@@ -402,15 +387,7 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
           {
             continue;
           }
-          std::vector<float> waveform;
-          waveform.reserve(m_nsamples);
-
-          for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-          {
-            waveform.push_back(0);
-          }
-          waveforms.push_back(waveform);
-          waveform.clear();
+          waveforms.add_channel(m_nzerosuppsamples, 0);
         }
       }
     }
@@ -422,14 +399,7 @@ int CaloTowerBuilder::process_data(PHCompositeNode *topNode, std::vector<std::ve
         {
           continue;
         }
-        std::vector<float> waveform;
-        waveform.reserve(2);
-        for (int samp = 0; samp < m_nzerosuppsamples; samp++)
-        {
-          waveform.push_back(-1);  // push back -1 for missing packets
-        }
-        waveforms.push_back(waveform);
-        waveform.clear();
+        waveforms.add_channel(m_nzerosuppsamples, -1);  // -1 for missing packets
       }
     }
     return Fun4AllReturnCodes::EVENT_OK;
@@ -475,7 +445,8 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
   {
     return process_sim();
   }
-  std::vector<std::vector<float>> waveforms;
+  CaloWaveformBlock &waveforms = m_waveforms;
+  waveforms.clear();
   if (process_data(topNode, waveforms) == Fun4AllReturnCodes::ABORTEVENT)
   {
     return Fun4AllReturnCodes::ABORTEVENT;
@@ -514,10 +485,11 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
       towerinfo->set_isRecovered(true);
     }
     towerinfo->set_FitStatus(static_cast<bool>(processed_waveforms.at(idx).at(5)));
-    int n_samples = waveforms.at(idx).size();
+    const auto waveform = waveforms.channel(idx);
+    int n_samples = waveform.size();
     if (n_samples == m_nzerosuppsamples || SZS)
     {
-      if (waveforms.at(idx).at(0) == -1)
+      if (waveform[0] == -1)
       {
         towerinfo->set_isNotInstr(true);
       }
@@ -529,15 +501,13 @@ int CaloTowerBuilder::process_event(PHCompositeNode *topNode)
 
     for (int j = 0; j < n_samples; j++)
     {
-      if (std::round(waveforms.at(idx).at(j)) >= m_saturation)
+      if (std::round(waveform[j]) >= m_saturation)
       {
         towerinfo->set_isSaturated(true);
       }
-      towerinfo->set_waveform_value(j, waveforms.at(idx).at(j));
+      towerinfo->set_waveform_value(j, waveform[j]);
     }
   }
-  waveforms.clear();
-
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
@@ -6,6 +6,8 @@
 #include "CaloTowerDefs.h"
 #include "CaloWaveformProcessing.h"
 
+#include <calobase/CaloWaveformBlock.h>
+
 #include <cdbobjects/CDBTTree.h>  // for CDBTTree
 
 #include <fun4all/SubsysReco.h>
@@ -29,7 +31,7 @@ public:
 
   void CreateNodeTree(PHCompositeNode *topNode);
 
-  int process_data(PHCompositeNode *topNode, std::vector<std::vector<float>> &waveforms);
+  int process_data(PHCompositeNode *topNode, CaloWaveformBlock &waveforms);
 
   void set_detector_type(CaloTowerDefs::DetectorSystem dettype)
   {
@@ -139,6 +141,7 @@ private:
   CDBTTree *cdbttree = nullptr;
   CDBTTree *cdbttree_sepd_map = nullptr;
   CDBTTree *cdbttree_tbt_zs = nullptr;
+  CaloWaveformBlock m_waveforms;  // raw waveforms, reused event by event
 
   bool m_isdata{true};
   bool m_bdosoftwarezerosuppression{false};
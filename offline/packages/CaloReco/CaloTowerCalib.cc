@@ -244,20 +244,33 @@ void CaloTowerCalib::LoadCalib(PHCompositeNode *topNode)
   unsigned int ntowers = _raw_towers->size();
   m_cdbInfo_vec.resize(ntowers);
 
+  // fetch the columns once, reads only these fields from the calibration files
+  CDBColumn<float> calibconst = cdbttree->GetFloatColumn(m_fieldname);
+  CDBColumn<float> crosscalibconst;
+  if (m_doZScrosscalib)
+  {
+    crosscalibconst = cdbttree_ZScrosscalib->GetFloatColumn(m_fieldname_ZScrosscalib);
+  }
+  CDBColumn<float> meantime;
+  if (m_dotimecalib)
+  {
+    meantime = cdbttree_time->GetFloatColumn(m_fieldname_time);
+  }
+
   for (unsigned int channel = 0; channel < ntowers; channel++)
   {
     unsigned int key = _raw_towers->encode_key(channel);
 
-    m_cdbInfo_vec[channel].calibconst = cdbttree->GetFloatValue(key, m_fieldname);
+    m_cdbInfo_vec[channel].calibconst = calibconst(key);
 
     if (m_doZScrosscalib)
     {
-      m_cdbInfo_vec[channel].crosscalibconst = cdbttree_ZScrosscalib->GetFloatValue(key, m_fieldname_ZScrosscalib);
+      m_cdbInfo_vec[channel].crosscalibconst = crosscalibconst(key);
     }
 
     if(m_dotimecalib)
     {
-      m_cdbInfo_vec[channel].meantime = cdbttree_time->GetFloatValue(key, m_fieldname_time);
+      m_cdbInfo_vec[channel].meantime = meantime(key);
     }
   }
 }
@@ -191,18 +191,32 @@ void CaloTowerStatus::LoadCalib()
   unsigned int ntowers = m_raw_towers->size();
   m_cdbInfo_vec.resize(ntowers);
 
+  // fetch the columns once, reads only these fields from the calibration files
+  CDBColumn<float> fraction_badChi2;
+  if (m_doHotChi2)
+  {
+    fraction_badChi2 = m_cdbttree_chi2->GetFloatColumn(m_fieldname_chi2);
+  }
+  CDBColumn<int> hotMap_val;
+  CDBColumn<float> z_score;
+  if (m_doHotMap)
+  {
+    hotMap_val = m_cdbttree_hotMap->GetIntColumn(m_fieldname_hotMap);
+    z_score = m_cdbttree_hotMap->GetFloatColumn(m_fieldname_z_score);
+  }
+
   for (unsigned int channel = 0; channel < ntowers; channel++)
   {
     unsigned int key = m_raw_towers->encode_key(channel);
 
     if (m_doHotChi2)
     {
-      m_cdbInfo_vec[channel].fraction_badChi2 = m_cdbttree_chi2->GetFloatValue(key, m_fieldname_chi2);
+      m_cdbInfo_vec[channel].fraction_badChi2 = fraction_badChi2(key);
     }
     if (m_doHotMap)
     {
-      m_cdbInfo_vec[channel].hotMap_val = m_cdbttree_hotMap->GetIntValue(key, m_fieldname_hotMap);
-      m_cdbInfo_vec[channel].z_score = m_cdbttree_hotMap->GetFloatValue(key, m_fieldname_z_score);
+      m_cdbInfo_vec[channel].hotMap_val = hotMap_val(key);
+      m_cdbInfo_vec[channel].z_score = z_score(key);
     }
   }
 }
@@ -1,5 +1,7 @@
 #include "CaloWaveformFitting.h"
 
+#include <calobase/CaloWaveformBlock.h>
+
 #include <TF1.h>
 #include <TFile.h>
 #include <TH1F.h>
@@ -386,65 +388,79 @@ void CaloWaveformFitting::FastMax(float x0, float x1, float x2, float y0, float
   delete sp;
   return;
 }
-std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_fast(const std::vector<std::vector<float>> &chnlvector)
+template <class Samples>
+std::vector<float> CaloWaveformFitting::FastFit(const Samples &v)
 {
-  std::vector<std::vector<float>> fit_values;
-  int nchnls = chnlvector.size();
-  for (int m = 0; m < nchnls; m++)
+  int nsamples = v.size();
+
+  double maxy = (nsamples > 0) ? v[0] : 0;
+  float amp = 0;
+  float time = 0;
+  float ped = 0;
+  float chi2 = std::numeric_limits<float>::quiet_NaN();
+  if (nsamples == 2)
   {
-    const std::vector<float> &v = chnlvector.at(m);
-    int nsamples = v.size();
-
-    double maxy = v.at(0);
-    float amp = 0;
-    float time = 0;
-    float ped = 0;
-    float chi2 = std::numeric_limits<float>::quiet_NaN();
-    if (nsamples == 2)
+    amp = v[1];
+    time = std::numeric_limits<float>::quiet_NaN();
+    ped = v[0];
+    if (v[0] != 0 && v[1] == 0)  // check if post-sample is 0, if so set high chi2
     {
-      amp = v.at(1);
-      time = std::numeric_limits<float>::quiet_NaN();
-      ped = v.at(0);
-      if (v.at(0) != 0 && v.at(1) == 0)  // check if post-sample is 0, if so set high chi2
-      {
-        chi2 = 1000000;
-      }
+      chi2 = 1000000;
     }
-    else if (nsamples >= 3)
+  }
+  else if (nsamples >= 3)
+  {
+    int maxx = 0;
+    for (int i = 0; i < nsamples; i++)
     {
-      int maxx = 0;
-      for (int i = 0; i < nsamples; i++)
+      if (i < 3)
       {
-        if (i < 3)
-        {
-          ped += v.at(i);
-        }
-        if (v.at(i) > maxy)
-        {
-          maxy = v.at(i);
-          maxx = i;
-        }
+        ped += v[i];
       }
-      ped /= 3;
-      // if maxx <=5 nsample >=10 use the last two sample for pedestal(for HCal TP)
-      if (maxx <= 5 && nsamples >= 10)
+      if (v[i] > maxy)
       {
-        ped = 0.5 * (v.at(nsamples - 2) + v.at(nsamples - 1));
-      }
-      if (maxx == 0 || maxx == nsamples - 1)
-      {
-        amp = maxy;
-        time = maxx;
-      }
-      else
-      {
-        FastMax(maxx - 1, maxx, maxx + 1, v.at(maxx - 1), v.at(maxx), v.at(maxx + 1), time, amp);
+        maxy = v[i];
+        maxx = i;
       }
     }
-    amp -= ped;
-    std::vector<float> val = {amp, time, ped, chi2, 0, 0};
-    fit_values.push_back(val);
-    val.clear();
+    ped /= 3;
+    // if maxx <=5 nsample >=10 use the last two sample for pedestal(for HCal TP)
+    if (maxx <= 5 && nsamples >= 10)
+    {
+      ped = 0.5 * (v[nsamples - 2] + v[nsamples - 1]);
+    }
+    if (maxx == 0 || maxx == nsamples - 1)
+    {
+      amp = maxy;
+      time = maxx;
+    }
+    else
+    {
+      FastMax(maxx - 1, maxx, maxx + 1, v[maxx - 1], v[maxx], v[maxx + 1], time, amp);
+    }
+  }
+  amp -= ped;
+  return {amp, time, ped, chi2, 0, 0};
+}
+
+std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_fast(const std::vector<std::vector<float>> &chnlvector)
+{
+  std::vector<std::vector<float>> fit_values;
+  fit_values.reserve(chnlvector.size());
+  for (const auto &v : chnlvector)
+  {
+    fit_values.push_back(FastFit(v));
+  }
+  return fit_values;
+}
+
+std::vector<std::vector<float>> CaloWaveformFitting::calo_processing_fast(const CaloWaveformBlock &waveforms)
+{
+  std::vector<std::vector<float>> fit_values;
+  fit_values.reserve(waveforms.size());
+  for (unsigned int ch = 0; ch < waveforms.size(); ch++)
+  {
+    fit_values.push_back(FastFit(waveforms.channel(ch)));
   }
   return fit_values;
 }
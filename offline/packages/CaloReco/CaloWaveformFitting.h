@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+class CaloWaveformBlock;
 class TProfile;
 
 class CaloWaveformFitting
@@ -67,6 +68,8 @@ class CaloWaveformFitting
   std::vector<std::vector<float>> process_waveform(std::vector<std::vector<float>> waveformvector);
   std::vector<std::vector<float>> calo_processing_templatefit(std::vector<std::vector<float>> chnlvector);
   static std::vector<std::vector<float>> calo_processing_fast(const std::vector<std::vector<float>> &chnlvector);
+  // same as above, reads the samples in place
+  static std::vector<std::vector<float>> calo_processing_fast(const CaloWaveformBlock &waveforms);
   std::vector<std::vector<float>> calo_processing_nyquist(const std::vector<std::vector<float>> &chnlvector);
   std::vector<std::vector<float>> calo_processing_funcfit(const std::vector<std::vector<float>> &chnlvector);
 
@@ -99,6 +102,9 @@ class CaloWaveformFitting
 
  private:
   static void FastMax(float x0, float x1, float x2, float y0, float y1, float y2, float &xmax, float &ymax);
+  // amplitude, time, pedestal, chi2 of the fast processing of one channel
+  template <class Samples>
+  static std::vector<float> FastFit(const Samples &v);
   std::vector<float> NyquistInterpolation(std::vector<float> &vec_signal_samples);
   static double Dkernelodd(double x, int N);
   static double Dkernel(double x, int N);
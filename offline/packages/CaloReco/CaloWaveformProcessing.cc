@@ -1,6 +1,8 @@
 #include "CaloWaveformProcessing.h"
 #include "CaloWaveformFitting.h"
 
+#include <calobase/CaloWaveformBlock.h>
+
 #include <ffamodules/CDBInterface.h>
 
 #include <phool/onnxlib.h>
@@ -12,6 +14,7 @@
 #include <limits>
 #include <memory>  // for allocator_traits<>::value_type
 #include <string>
+#include <utility>  // for move
 
 namespace
 {
@@ -111,6 +114,25 @@ std::vector<std::vector<float>> CaloWaveformProcessing::process_waveform(std::ve
   return fitresults;
 }
 
+std::vector<std::vector<float>> CaloWaveformProcessing::process_waveform(const CaloWaveformBlock &waveforms)
+{
+  if (m_processingtype == CaloWaveformProcessing::FAST)
+  {
+    return CaloWaveformFitting::calo_processing_fast(waveforms);
+  }
+  std::vector<std::vector<float>> waveformvector;
+  waveformvector.reserve(waveforms.size());
+  for (unsigned int i = 0; i < waveforms.size(); i++)
+  {
+    const auto samples = waveforms.channel(i);
+    // one extra for the channel number the template fit appends
+    std::vector<float> &waveform = waveformvector.emplace_back();
+    waveform.reserve(samples.size() + 1);
+    waveform.assign(samples.begin(), samples.end());
+  }
+  return process_waveform(std::move(waveformvector));
+}
+
 std::vector<std::vector<float>> CaloWaveformProcessing::calo_processing_ONNX(const std::vector<std::vector<float>> &chnlvector)
 {
   std::vector<std::vector<float>> fit_values;
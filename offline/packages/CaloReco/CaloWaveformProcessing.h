@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+class CaloWaveformBlock;
 class CaloWaveformFitting;
 
 class CaloWaveformProcessing : public SubsysReco
@@ -97,6 +98,8 @@ class CaloWaveformProcessing : public SubsysReco
   }
 
   std::vector<std::vector<float>> process_waveform(std::vector<std::vector<float>> waveformvector);
+  // the fast processing reads the block in place, the other methods get a vector per channel
+  std::vector<std::vector<float>> process_waveform(const CaloWaveformBlock &waveforms);
   std::vector<std::vector<float>> calo_processing_ONNX(const std::vector<std::vector<float>> &chnlvector);
 
   void initialize_processing();
@@ -70,6 +70,7 @@
 #include <iterator>   // for end
 #include <map>        // for _Rb_tree_iterator, map
 #include <memory>     // for allocator_traits<>::va...
+#include <set>
 
 KFParticle_truthAndDetTools toolSet;
 
@@ -513,118 +514,171 @@ std::vector<int> KFParticle_Tools::findAllGoodTracks(const std::vector<KFParticl
   return goodTrackIndex;
 }
 
-std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(std::vector<KFParticle> daughterParticles, std::vector<int> goodTrackIndex, int nTracks) const
+std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks) const
+{
+  PairCompatibility pairs(daughterParticles, goodTrackIndex, m_comb_DCA, m_comb_DCA_xy);
+  return findTwoProngs(daughterParticles, goodTrackIndex, nTracks, pairs);
+}
+
+std::vector<std::vector<int>> KFParticle_Tools::findNProngs(const std::vector<KFParticle> &daughterParticles,
+                                                            const std::vector<int> &goodTrackIndex,
+                                                            const std::vector<std::vector<int>> &goodTracksThatMeet,
+                                                            int nRequiredTracks, unsigned int nProngs) const
+{
+  PairCompatibility pairs(daughterParticles, goodTrackIndex, m_comb_DCA, m_comb_DCA_xy);
+  return findNProngs(daughterParticles, goodTrackIndex, goodTracksThatMeet, nRequiredTracks, nProngs, pairs);
+}
+
+std::vector<std::vector<int>> KFParticle_Tools::findNProngCandidates(const std::vector<KFParticle> &daughterParticles,
+                                                                     const std::vector<int> &goodTrackIndex,
+                                                                     int nTracks) const
+{
+  // One pair table serves every multiplicity, so each track pair is only ever
+  // tested once no matter how many higher-order combinations it ends up in
+  PairCompatibility pairs(daughterParticles, goodTrackIndex, m_comb_DCA, m_comb_DCA_xy);
+
+  std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticles, goodTrackIndex, nTracks, pairs);
+  for (int p = 3; p <= nTracks; ++p)
+  {
+    if (goodTracksThatMeet.empty())
+    {
+      break;
+    }
+    goodTracksThatMeet = findNProngs(daughterParticles, goodTrackIndex, goodTracksThatMeet, nTracks, p, pairs);
+  }
+
+  return goodTracksThatMeet;
+}
+
+std::vector<std::vector<int>> KFParticle_Tools::findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks, PairCompatibility &pairs) const
 {
   std::vector<std::vector<int>> goodTracksThatMeet;
 
-  for (std::vector<int>::iterator i_it = goodTrackIndex.begin(); i_it != goodTrackIndex.end(); ++i_it)
+  for (unsigned int i = 0; i < goodTrackIndex.size(); ++i)
   {
-    for (std::vector<int>::iterator j_it = goodTrackIndex.begin(); j_it != goodTrackIndex.end(); ++j_it)
+    for (unsigned int j = i + 1; j < goodTrackIndex.size(); ++j)
     {
-      if (i_it < j_it)
+      if (!pairs.isCompatible(goodTrackIndex[i], goodTrackIndex[j]))
       {
-        float dca = daughterParticles[*i_it].GetDistanceFromParticle(daughterParticles[*j_it]);
-        float dca_xy = abs(daughterParticles[*i_it].GetDistanceFromParticleXY(daughterParticles[*j_it]));
+        continue;
+      }
 
-        if (dca <= m_comb_DCA && dca_xy <= m_comb_DCA_xy)
-        {
-          KFVertex twoParticleVertex;
-          twoParticleVertex += daughterParticles[*i_it];
-          twoParticleVertex += daughterParticles[*j_it];
-          float vertexchi2ndof = twoParticleVertex.GetChi2() / twoParticleVertex.GetNDF();
-          float sv_radial_position = sqrt(pow(twoParticleVertex.GetX(), 2) + pow(twoParticleVertex.GetY(), 2));
-          std::vector<int> combination = {*i_it, *j_it};
-
-          if (nTracks == 2 && vertexchi2ndof > m_vertex_chi2ndof)
-          {
-            continue;
-          }
-
-          if (nTracks == 2 && sv_radial_position < m_min_radial_SV)
-          {
-            continue;
-          }
-
-          goodTracksThatMeet.push_back(combination);
-        }
+      // The vertex is only used for the cuts on the final multiplicity
+      if (nTracks == 2 && !passesVertexCuts(daughterParticles, {goodTrackIndex[i], goodTrackIndex[j]}))
+      {
+        continue;
       }
+
+      goodTracksThatMeet.push_back({goodTrackIndex[i], goodTrackIndex[j]});
     }
   }
 
   return goodTracksThatMeet;
 }
 
-std::vector<std::vector<int>> KFParticle_Tools::findNProngs(std::vector<KFParticle> daughterParticles,
+std::vector<std::vector<int>> KFParticle_Tools::findNProngs(const std::vector<KFParticle> &daughterParticles,
                                                             const std::vector<int> &goodTrackIndex,
-                                                            std::vector<std::vector<int>> goodTracksThatMeet,
-                                                            int nRequiredTracks, unsigned int nProngs)
+                                                            const std::vector<std::vector<int>> &goodTracksThatMeet,
+                                                            int nRequiredTracks, unsigned int nProngs,
+                                                            PairCompatibility &pairs) const
 {
-  unsigned int nGoodProngs = goodTracksThatMeet.size();
+  std::vector<std::vector<int>> goodTracksThatMeetNProngs;
+  std::set<std::vector<int>> uniqueCombinations;
+
+  const bool isLastProng = (unsigned int) nRequiredTracks == nProngs;
 
+  std::vector<int> combination(nProngs);
   for (const auto &i_it : goodTrackIndex)
   {
-    for (unsigned int i_prongs = 0; i_prongs < nGoodProngs; ++i_prongs)
+    for (const auto &prong : goodTracksThatMeet)
     {
-      bool trackNotUsedAlready = true;
-      for (unsigned int i_trackCheck = 0; i_trackCheck < nProngs - 1; ++i_trackCheck)
+      bool trackIsCompatible = true;
+      for (unsigned int i = 0; i < nProngs - 1; ++i)
       {
-        if (i_it == goodTracksThatMeet[i_prongs][i_trackCheck])
+        if (i_it == prong[i] || !pairs.isCompatible(i_it, prong[i]))
         {
-          trackNotUsedAlready = false;
+          trackIsCompatible = false;
+          break;
         }
       }
-      if (trackNotUsedAlready)
+      if (!trackIsCompatible)
       {
-        bool dcaMet = true;
-        for (unsigned int i = 0; i < nProngs - 1; ++i)
-        {
-          float dca = daughterParticles[i_it].GetDistanceFromParticle(daughterParticles[goodTracksThatMeet[i_prongs][i]]);
-          float dca_xy = abs(daughterParticles[i_it].GetDistanceFromParticleXY(daughterParticles[goodTracksThatMeet[i_prongs][i]]));
+        continue;
+      }
 
-          if (dca > m_comb_DCA || dca_xy > m_comb_DCA_xy)
-          {
-            dcaMet = false;
-          }
-        }
+      combination[0] = i_it;
+      std::copy(prong.begin(), prong.begin() + nProngs - 1, combination.begin() + 1);
 
-        if (dcaMet)
-        {
-          KFVertex particleVertex;
-          particleVertex += daughterParticles[i_it];
-          std::vector<int> combination;
-          combination.push_back(i_it);
-          for (unsigned int i = 0; i < nProngs - 1; ++i)
-          {
-            particleVertex += daughterParticles[goodTracksThatMeet[i_prongs][i]];
-            combination.push_back(goodTracksThatMeet[i_prongs][i]);
-          }
-          float vertexchi2ndof = particleVertex.GetChi2() / particleVertex.GetNDF();
-          float sv_radial_position = sqrt(pow(particleVertex.GetX(), 2) + pow(particleVertex.GetY(), 2));
-
-          if ((unsigned int) nRequiredTracks == nProngs && vertexchi2ndof > m_vertex_chi2ndof)
-          {
-            continue;
-          }
-
-          if ((unsigned int) nRequiredTracks == nProngs && sv_radial_position < m_min_radial_SV)
-          {
-            continue;
-          }
-
-          goodTracksThatMeet.push_back(combination);
-        }
+      if (isLastProng && !passesVertexCuts(daughterParticles, combination))
+      {
+        continue;
+      }
+
+      // Keep the first occurrence of every track set, as removeDuplicates would
+      std::sort(combination.begin(), combination.end());
+      if (uniqueCombinations.insert(combination).second)
+      {
+        goodTracksThatMeetNProngs.push_back(combination);
       }
     }
   }
 
-  goodTracksThatMeet.erase(goodTracksThatMeet.begin(), goodTracksThatMeet.begin() + nGoodProngs);
-  for (auto &i : goodTracksThatMeet)
+  return goodTracksThatMeetNProngs;
+}
+
+bool KFParticle_Tools::passesVertexCuts(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &combination) const
+{
+  KFVertex particleVertex;
+  for (const auto &track : combination)
   {
-    sort(i.begin(), i.end());
+    particleVertex += daughterParticles[track];
   }
-  removeDuplicates(goodTracksThatMeet);
+  float vertexchi2ndof = particleVertex.GetChi2() / particleVertex.GetNDF();
+  float sv_radial_position = sqrt(pow(particleVertex.GetX(), 2) + pow(particleVertex.GetY(), 2));
 
-  return goodTracksThatMeet;
+  return !(vertexchi2ndof > m_vertex_chi2ndof) && !(sv_radial_position < m_min_radial_SV);
+}
+
+KFParticle_Tools::PairCompatibility::PairCompatibility(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, float maxDCA, float maxDCAxy)
+  : m_daughters(daughterParticles)
+  , m_slot(daughterParticles.size(), -1)
+  , m_max_dca(maxDCA)
+  , m_max_dca_xy(maxDCAxy)
+{
+  for (const auto &track : goodTrackIndex)
+  {
+    if (m_slot[track] < 0)
+    {
+      m_slot[track] = m_nSlots++;
+    }
+  }
+  m_state.assign(m_nSlots * m_nSlots, Unknown);
+}
+
+bool KFParticle_Tools::PairCompatibility::isCompatible(int first, int second)
+{
+  // The DCA is evaluated from the first track, exactly as the combinatorics
+  // always did, so cached decisions are identical to recomputed ones
+  if (m_slot[first] < 0 || m_slot[second] < 0)
+  {
+    return evaluate(first, second);
+  }
+
+  signed char &state = m_state[m_slot[first] * m_nSlots + m_slot[second]];
+  if (state == Unknown)
+  {
+    state = evaluate(first, second) ? Compatible : Incompatible;
+  }
+
+  return state == Compatible;
+}
+
+bool KFParticle_Tools::PairCompatibility::evaluate(int first, int second) const
+{
+  float dca = m_daughters[first].GetDistanceFromParticle(m_daughters[second]);
+  float dca_xy = abs(m_daughters[first].GetDistanceFromParticleXY(m_daughters[second]));
+
+  return dca <= m_max_dca && dca_xy <= m_max_dca_xy;
 }
 
 std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFParticle intermediateResonances[], const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int num_remaining_tracks)
@@ -644,16 +698,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
       {
         dummyTrackID.push_back(k);
       }
-      dummyTrackList = findTwoProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
-      if (v_intermediateResonances.size() > 2)
-      {
-        for (unsigned int p = 3; p <= v_intermediateResonances.size(); ++p)
-        {
-          dummyTrackList = findNProngs(v_intermediateResonances,
-                                       dummyTrackID, dummyTrackList,
-                                       (int) v_intermediateResonances.size(), (int) p);
-        }
-      }
+      dummyTrackList = findNProngCandidates(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
 
       if (!dummyTrackList.empty())
       {
@@ -664,12 +709,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
   }
   else
   {
-    goodTracksThatMeet = findTwoProngs(daughterParticles, goodTrackIndex, num_remaining_tracks);
-
-    for (int p = 3; p <= num_remaining_tracks; ++p)
-    {
-      goodTracksThatMeet = findNProngs(daughterParticles, goodTrackIndex, goodTracksThatMeet, num_remaining_tracks, p);
-    }
+    goodTracksThatMeet = findNProngCandidates(daughterParticles, goodTrackIndex, num_remaining_tracks);
 
     for (auto &i : goodTracksThatMeet)
     {
@@ -685,11 +725,7 @@ std::vector<std::vector<int>> KFParticle_Tools::appendTracksToIntermediates(KFPa
       {
         dummyTrackID.push_back(k);
       }
-      dummyTrackList = findTwoProngs(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
-      for (unsigned int p = 3; p <= v_intermediateResonances.size(); ++p)
-      {
-        dummyTrackList = findNProngs(v_intermediateResonances, dummyTrackID, dummyTrackList, (int) v_intermediateResonances.size(), (int) p);
-      }
+      dummyTrackList = findNProngCandidates(v_intermediateResonances, dummyTrackID, (int) v_intermediateResonances.size());
 
       if (!dummyTrackList.empty())
       {
@@ -75,12 +75,17 @@ class KFParticle_Tools : protected KFParticle_MVA
 
   std::vector<int> findAllGoodTracks(const std::vector<KFParticle> &daughterParticles, const std::vector<KFParticle> &primaryVertices);
 
-  std::vector<std::vector<int>> findTwoProngs(std::vector<KFParticle> daughterParticles, std::vector<int> goodTrackIndex, int nTracks) const;
+  std::vector<std::vector<int>> findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks) const;
 
-  std::vector<std::vector<int>> findNProngs(std::vector<KFParticle> daughterParticles,
+  std::vector<std::vector<int>> findNProngs(const std::vector<KFParticle> &daughterParticles,
                                             const std::vector<int> &goodTrackIndex,
-                                            std::vector<std::vector<int>> goodTracksThatMeet,
-                                            int nRequiredTracks, unsigned int nProngs);
+                                            const std::vector<std::vector<int>> &goodTracksThatMeet,
+                                            int nRequiredTracks, unsigned int nProngs) const;
+
+  /// Builds all nTracks-prong combinations in one go, testing each track pair only once
+  std::vector<std::vector<int>> findNProngCandidates(const std::vector<KFParticle> &daughterParticles,
+                                                     const std::vector<int> &goodTrackIndex,
+                                                     int nTracks) const;
 
   std::vector<std::vector<int>> appendTracksToIntermediates(KFParticle intermediateResonances[], const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int num_remaining_tracks);
 
@@ -277,6 +282,42 @@ class KFParticle_Tools : protected KFParticle_MVA
   TrkrClusterContainer *m_cluster_map{nullptr};
   PHG4TpcGeomContainer *m_geom_container{nullptr};
 
+  /// Lazily filled table of the pairwise DCA decision between good tracks
+  class PairCompatibility
+  {
+   public:
+    PairCompatibility(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, float maxDCA, float maxDCAxy);
+
+    bool isCompatible(int first, int second);
+
+   private:
+    enum : signed char
+    {
+      Unknown = -1,
+      Incompatible = 0,
+      Compatible = 1
+    };
+
+    bool evaluate(int first, int second) const;
+
+    const std::vector<KFParticle> &m_daughters;
+    std::vector<int> m_slot;
+    std::vector<signed char> m_state;
+    int m_nSlots{0};
+    float m_max_dca;
+    float m_max_dca_xy;
+  };
+
+  std::vector<std::vector<int>> findTwoProngs(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &goodTrackIndex, int nTracks, PairCompatibility &pairs) const;
+
+  std::vector<std::vector<int>> findNProngs(const std::vector<KFParticle> &daughterParticles,
+                                            const std::vector<int> &goodTrackIndex,
+                                            const std::vector<std::vector<int>> &goodTracksThatMeet,
+                                            int nRequiredTracks, unsigned int nProngs,
+                                            PairCompatibility &pairs) const;
+
+  bool passesVertexCuts(const std::vector<KFParticle> &daughterParticles, const std::vector<int> &combination) const;
+
   void removeDuplicates(std::vector<double> &v);
   void removeDuplicates(std::vector<int> &v);
   void removeDuplicates(std::vector<std::vector<int>> &v);
@@ -96,11 +96,7 @@ void KFParticle_eventReconstruction::buildBasicChain(std::vector<KFParticle>& se
                                                      const std::vector<int>& goodTrackIndexBasic,
                                                      const std::vector<KFParticle>& primaryVerticesBasic, PHCompositeNode* topNode)
 {
-  std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticlesBasic, goodTrackIndexBasic, m_num_tracks);
-  for (int p = 3; p < m_num_tracks + 1; ++p)
-  {
-    goodTracksThatMeet = findNProngs(daughterParticlesBasic, goodTrackIndexBasic, goodTracksThatMeet, m_num_tracks, p);
-  }
+  std::vector<std::vector<int>> goodTracksThatMeet = findNProngCandidates(daughterParticlesBasic, goodTrackIndexBasic, m_num_tracks);
 
   getCandidateDecay(selectedMotherBasic, selectedVertexBasic, selectedDaughtersBasic, daughterParticlesBasic,
                     goodTracksThatMeet, primaryVerticesBasic, 0, m_num_tracks, false, 0, true, topNode);
@@ -128,14 +124,7 @@ void KFParticle_eventReconstruction::buildChain(std::vector<KFParticle>& selecte
   for (int i = 0; i < m_num_intermediate_states; ++i)
   {
     std::vector<KFParticle> vertices;
-    std::vector<std::vector<int>> goodTracksThatMeet = findTwoProngs(daughterParticlesAdv, goodTrackIndexAdv, m_num_tracks_from_intermediate[i]);
-    for (int p = 3; p <= m_num_tracks_from_intermediate[i]; ++p)
-    {
-      goodTracksThatMeet = findNProngs(daughterParticlesAdv,
-                                       goodTrackIndexAdv,
-                                       goodTracksThatMeet,
-                                       m_num_tracks_from_intermediate[i], p);
-    }
+    std::vector<std::vector<int>> goodTracksThatMeet = findNProngCandidates(daughterParticlesAdv, goodTrackIndexAdv, m_num_tracks_from_intermediate[i]);
     getCandidateDecay(potentialIntermediates[i], vertices, potentialDaughters[i], daughterParticlesAdv,
                       goodTracksThatMeet, primaryVerticesAdv, track_start, track_stop, true, i, m_constrain_int_mass, topNode);
     track_start += track_stop;
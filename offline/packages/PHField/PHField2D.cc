@@ -1,5 +1,7 @@
 #include "PHField2D.h"
 
+#include "PHFieldMapCache.h"
+
 // root framework
 #include <TDirectory.h>
 #include <TFile.h>
@@ -18,15 +20,28 @@
 
 PHField2D::PHField2D(const std::string &filename, const int verb, const float magfield_rescale)
   : PHField(verb)
+  , m_magfield_rescale(magfield_rescale)
   , r_index0_cache(0)
   , r_index1_cache(0)
   , z_index0_cache(0)
   , z_index1_cache(0)
+  , m_filename(filename)
 {
   if (Verbosity() > 0)
   {
     std::cout << " ------------- PHField2D::PHField2D() ------------------" << std::endl;
   }
+  // a valid binary cache skips the ntuple parsing and sorting below
+  if (ReadCache(filename))
+  {
+    if (Verbosity() > 0)
+    {
+      std::cout << "  Mapped field grid cache: " << PHFieldMapCache::cache_filename(filename) << std::endl;
+      std::cout << "  Mag field z boundaries (min,max): (" << minz_ / cm << ", " << maxz_ / cm << ") cm" << std::endl;
+      std::cout << " -----------------------------------------------------------" << std::endl;
+    }
+    return;
+  }
   // open file
   TFile *rootinput = TFile::Open(filename.c_str());
   if (!rootinput)
@@ -154,9 +169,13 @@ PHField2D::PHField2D(const std::string &filename, const int verb, const float ma
   std::copy(z_set.begin(), z_set.end(), z_map_.begin());
   std::copy(r_set.begin(), r_set.end(), r_map_.begin());
 
-  // initialize the field map vectors to the correct sizes
-  BFieldR_.resize(nz, std::vector<float>(nr, 0));
-  BFieldZ_.resize(nz, std::vector<float>(nr, 0));
+  // initialize the field map arrays to the correct sizes
+  const size_t nentries = (size_t) nz * nr;
+  m_field_storage.assign(2 * nentries, 0);
+  float *bz_storage = m_field_storage.data();
+  float *br_storage = bz_storage + nentries;
+  BFieldZ_ = bz_storage;
+  BFieldR_ = br_storage;
 
   // all of this assumes that  z_prev < z , i.e. the table is ordered (as of right now)
   unsigned int ir = 0;
@@ -190,8 +209,9 @@ PHField2D::PHField2D(const std::string &filename, const int verb, const float ma
       std::cout << "!!!!!!!!! Your map isn't ordered.... z: " << z << " zprev: " << z_map_[iz - 1] << std::endl;
     }
 
-    BFieldR_[iz][ir] = Br * magfield_rescale;
-    BFieldZ_[iz][ir] = Bz * magfield_rescale;
+    // rescale is applied at lookup, so that the binary cache is independent of it
+    br_storage[index(iz, ir)] = Br;
+    bz_storage[index(iz, ir)] = Bz;
 
     // you can change this to check table values for correctness
     // print_map prints the values in the root table, and the
@@ -203,8 +223,8 @@ PHField2D::PHField2D(const std::string &filename, const int verb, const float ma
       std::cout << " B("
                 << r_map_[ir] << ", "
                 << z_map_[iz] << "):  ("
-                << BFieldR_[iz][ir] << ", "
-                << BFieldZ_[iz][ir] << ")" << std::endl;
+                << BFieldR_[index(iz, ir)] * magfield_rescale << ", "
+                << BFieldZ_[index(iz, ir)] * magfield_rescale << ")" << std::endl;
     }
 
   }  // end loop over root field map file
@@ -226,6 +246,53 @@ PHField2D::PHField2D(const std::string &filename, const int verb, const float ma
   }
 }
 
+PHField2D::~PHField2D() = default;
+
+bool PHField2D::ReadCache(const std::string &filename)
+{
+  auto cache = std::make_unique<PHFieldMapCache>();
+  if (!cache->open(filename, 2))
+  {
+    return false;
+  }
+  const PHFieldMapCache::Header &header = cache->header();
+
+  // the axes are small, copy them so the lookup code keeps using vectors
+  z_map_.assign(cache->z_map(), cache->z_map() + header.nz);
+  r_map_.assign(cache->r_map(), cache->r_map() + header.nr);
+  minz_ = header.minz;
+  maxz_ = header.maxz;
+  magfield_unit = header.field_unit;
+
+  BFieldZ_ = cache->bz();
+  BFieldR_ = cache->br();
+  m_cache = std::move(cache);
+  return true;
+}
+
+bool PHField2D::WriteCache() const
+{
+  if (m_cache)
+  {
+    return true;
+  }
+  PHFieldMapCache::Header header;
+  header.ndim = 2;
+  header.field_unit = magfield_unit;
+  header.minz = minz_;
+  header.maxz = maxz_;
+  // a 2D map is stored as a single phi bin
+  const std::vector<float> phi_map(1, 0);
+  const bool written = PHFieldMapCache::write(m_filename, header, z_map_, r_map_, phi_map, BFieldZ_, BFieldR_, nullptr);
+  if (Verbosity() > 0)
+  {
+    std::cout << "PHField2D::WriteCache - "
+              << (written ? "wrote " : "could not write ")
+              << PHFieldMapCache::cache_filename(m_filename) << std::endl;
+  }
+  return written;
+}
+
 void PHField2D::GetFieldValue(const double point[4], double *Bfield) const
 {
   if (Verbosity() > 2)
@@ -419,15 +486,15 @@ void PHField2D::GetFieldCyl(const double CylPoint[4], double *BfieldCyl) const
     z_index1_cache = z_index1;
   }
 
-  double Br000 = BFieldR_[z_index0][r_index0];
-  double Br010 = BFieldR_[z_index0][r_index1];
-  double Br100 = BFieldR_[z_index1][r_index0];
-  double Br110 = BFieldR_[z_index1][r_index1];
+  double Br000 = BFieldR_[index(z_index0, r_index0)];
+  double Br010 = BFieldR_[index(z_index0, r_index1)];
+  double Br100 = BFieldR_[index(z_index1, r_index0)];
+  double Br110 = BFieldR_[index(z_index1, r_index1)];
 
-  double Bz000 = BFieldZ_[z_index0][r_index0];
-  double Bz100 = BFieldZ_[z_index1][r_index0];
-  double Bz010 = BFieldZ_[z_index0][r_index1];
-  double Bz110 = BFieldZ_[z_index1][r_index1];
+  double Bz000 = BFieldZ_[index(z_index0, r_index0)];
+  double Bz100 = BFieldZ_[index(z_index1, r_index0)];
+  double Bz010 = BFieldZ_[index(z_index0, r_index1)];
+  double Bz110 = BFieldZ_[index(z_index1, r_index1)];
 
   double zweight = z - z_map_[z_index0];
   double zspacing = z_map_[z_index1] - z_map_[z_index0];
@@ -451,6 +518,9 @@ void PHField2D::GetFieldCyl(const double CylPoint[4], double *BfieldCyl) const
       zweight * ((1 - rweight) * Br100 +
                  rweight * Br110);
 
+  BfieldCyl[0] *= m_magfield_rescale;
+  BfieldCyl[1] *= m_magfield_rescale;
+
   // PHI Direction of B-field
   BfieldCyl[2] = 0;
 
@@ -527,15 +597,15 @@ void PHField2D::GetFieldCyl_nocache(const double CylPoint[4], double *BfieldCyl)
     return;
   }
 
-  double Br000 = BFieldR_[z_index0][r_index0];
-  double Br010 = BFieldR_[z_index0][r_index1];
-  double Br100 = BFieldR_[z_index1][r_index0];
-  double Br110 = BFieldR_[z_index1][r_index1];
+  double Br000 = BFieldR_[index(z_index0, r_index0)];
+  double Br010 = BFieldR_[index(z_index0, r_index1)];
+  double Br100 = BFieldR_[index(z_index1, r_index0)];
+  double Br110 = BFieldR_[index(z_index1, r_index1)];
 
-  double Bz000 = BFieldZ_[z_index0][r_index0];
-  double Bz100 = BFieldZ_[z_index1][r_index0];
-  double Bz010 = BFieldZ_[z_index0][r_index1];
-  double Bz110 = BFieldZ_[z_index1][r_index1];
+  double Bz000 = BFieldZ_[index(z_index0, r_index0)];
+  double Bz100 = BFieldZ_[index(z_index1, r_index0)];
+  double Bz010 = BFieldZ_[index(z_index0, r_index1)];
+  double Bz110 = BFieldZ_[index(z_index1, r_index1)];
 
   double zweight = z - z_map_[z_index0];
   double zspacing = z_map_[z_index1] - z_map_[z_index0];
@@ -559,6 +629,9 @@ void PHField2D::GetFieldCyl_nocache(const double CylPoint[4], double *BfieldCyl)
       zweight * ((1 - rweight) * Br100 +
                  rweight * Br110);
 
+  BfieldCyl[0] *= m_magfield_rescale;
+  BfieldCyl[1] *= m_magfield_rescale;
+
   // PHI Direction of B-field
   BfieldCyl[2] = 0;
 
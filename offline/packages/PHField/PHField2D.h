@@ -4,17 +4,22 @@
 
 #include "PHField.h"
 
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
 
+class PHFieldMapCache;
+
 class PHField2D : public PHField
 {
   typedef std::tuple<float, float> trio;
 
  public:
   PHField2D(const std::string &filename, const int verb = 0, const float magfield_rescale = 1.0);
+  ~PHField2D() override;
 
   //! access field value
   //! Follow the convention of G4ElectroMagneticField
@@ -29,11 +34,19 @@ class PHField2D : public PHField
 
   void GetFieldCyl_nocache(const double CylPoint[4], double *Bfield) const;
 
+  //! write the binary cache of this map (see PHFieldMapCache), true if it was written or is already in use
+  bool WriteCache() const;
+
   protected:
-  // < i, j, k > , this allows i and i+1 to be neighbors ( <i,j,k>=<z,r,phi> )
-  std::vector<std::vector<float> > BFieldZ_;
-  std::vector<std::vector<float> > BFieldR_;
-  std::vector<std::vector<float> > BFieldPHI_;
+  //! flat index into the field arrays, this allows i and i+1 to be neighbors ( <i,j>=<z,r> )
+  size_t index(const unsigned int iz, const unsigned int ir) const
+  {
+    return iz * r_map_.size() + ir;
+  }
+
+  //! field components, without magfield rescale. Point either to m_field_storage or into the mapped cache
+  const float *BFieldZ_ = nullptr;
+  const float *BFieldR_ = nullptr;
 
   // maps indices to values z_map[i] = z_value that corresponds to ith index
   std::vector<float> z_map_;    // < i >
@@ -42,8 +55,12 @@ class PHField2D : public PHField
 
   float maxz_, minz_;  // boundaries of magnetic field map cyl
   double magfield_unit;
+  float m_magfield_rescale = 1.;
 
  private:
+  //! map the binary cache of filename, false if there is no valid one
+  bool ReadCache(const std::string &filename);
+
   void print_map(std::map<trio, trio>::iterator &it) const;
   // mutable allows to change internal data even in const methods
   // I don't like this too much but these are cached values to speed up
@@ -56,6 +73,14 @@ class PHField2D : public PHField
   mutable unsigned int r_index1_cache;
   mutable unsigned int z_index0_cache;
   mutable unsigned int z_index1_cache;
+
+  std::string m_filename;
+
+  //! field values when parsed from the ROOT file
+  std::vector<float> m_field_storage;
+
+  //! mapped binary cache
+  std::unique_ptr<PHFieldMapCache> m_cache;
 };
 
 #endif
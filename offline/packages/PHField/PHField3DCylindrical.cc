@@ -1,5 +1,7 @@
 #include "PHField3DCylindrical.h"
 
+#include "PHFieldMapCache.h"
+
 #include <TDirectory.h>  // for TDirectory, gDirectory
 #include <TFile.h>
 #include <TNtuple.h>
@@ -17,12 +19,25 @@
 
 PHField3DCylindrical::PHField3DCylindrical(const std::string &filename, const int verb, const float magfield_rescale)
   : PHField(verb)
+  , m_magfield_rescale(magfield_rescale)
+  , m_filename(filename)
 {
   std::cout << "\n================ Begin Construct Mag Field =====================" << std::endl;
   std::cout << "\n-----------------------------------------------------------"
             << "\n      Magnetic field Module - Verbosity:" << Verbosity()
             << "\n-----------------------------------------------------------";
 
+  // a valid binary cache skips the ntuple parsing and sorting below
+  if (ReadCache(filename))
+  {
+    std::cout << "\n ---> Mapped the field grid from " << PHFieldMapCache::cache_filename(filename)
+              << "\n ---> Z Boundaries ~ zlow, zhigh: "
+              << minz_ / cm << "," << maxz_ / cm << " cm " << std::endl;
+    std::cout << "\n================= End Construct Mag Field ======================\n"
+              << std::endl;
+    return;
+  }
+
   // open file
   TFile *rootinput = TFile::Open(filename.c_str());
   if (!rootinput)
@@ -142,10 +157,15 @@ PHField3DCylindrical::PHField3DCylindrical(const std::string &filename, const in
   std::copy(phi_set.begin(), phi_set.end(), phi_map_.begin());
   std::copy(r_set.begin(), r_set.end(), r_map_.begin());
 
-  // initialize the field map vectors to the correct sizes
-  BFieldR_.resize(nz, std::vector<std::vector<float> >(nr, std::vector<float>(nphi, 0)));
-  BFieldPHI_.resize(nz, std::vector<std::vector<float> >(nr, std::vector<float>(nphi, 0)));
-  BFieldZ_.resize(nz, std::vector<std::vector<float> >(nr, std::vector<float>(nphi, 0)));
+  // initialize the field map arrays to the correct sizes
+  const size_t nentries = (size_t) nz * nr * nphi;
+  m_field_storage.assign(3 * nentries, 0);
+  float *bz_storage = m_field_storage.data();
+  float *br_storage = bz_storage + nentries;
+  float *bphi_storage = br_storage + nentries;
+  BFieldZ_ = bz_storage;
+  BFieldR_ = br_storage;
+  BFieldPHI_ = bphi_storage;
 
   // all of this assumes that  z_prev < z , i.e. the table is ordered (as of right now)
   unsigned int ir = 0;
@@ -188,9 +208,10 @@ PHField3DCylindrical::PHField3DCylindrical(const std::string &filename, const in
       std::cout << "!!!!!!!!! Your map isn't ordered.... z: " << z << " zprev: " << z_map_[iz - 1] << std::endl;
     }
 
-    BFieldR_[iz][ir][iphi] = Br * magfield_rescale;
-    BFieldPHI_[iz][ir][iphi] = Bphi * magfield_rescale;
-    BFieldZ_[iz][ir][iphi] = Bz * magfield_rescale;
+    // rescale is applied at lookup, so that the binary cache is independent of it
+    br_storage[index(iz, ir, iphi)] = Br;
+    bphi_storage[index(iz, ir, iphi)] = Bphi;
+    bz_storage[index(iz, ir, iphi)] = Bz;
 
     // you can change this to check table values for correctness
     // print_map prints the values in the root table, and the
@@ -203,9 +224,9 @@ PHField3DCylindrical::PHField3DCylindrical(const std::string &filename, const in
                 << r_map_[ir] << ", "
                 << phi_map_[iphi] << ", "
                 << z_map_[iz] << "):  ("
-                << BFieldR_[iz][ir][iphi] << ", "
-                << BFieldPHI_[iz][ir][iphi] << ", "
-                << BFieldZ_[iz][ir][iphi] << ")" << std::endl;
+                << BFieldR_[index(iz, ir, iphi)] * magfield_rescale << ", "
+                << BFieldPHI_[index(iz, ir, iphi)] * magfield_rescale << ", "
+                << BFieldZ_[index(iz, ir, iphi)] * magfield_rescale << ")" << std::endl;
     }
 
   }  // end loop over root field map file
@@ -220,6 +241,52 @@ PHField3DCylindrical::PHField3DCylindrical(const std::string &filename, const in
             << std::endl;
 }
 
+PHField3DCylindrical::~PHField3DCylindrical() = default;
+
+bool PHField3DCylindrical::ReadCache(const std::string &filename)
+{
+  auto cache = std::make_unique<PHFieldMapCache>();
+  if (!cache->open(filename, 3))
+  {
+    return false;
+  }
+  const PHFieldMapCache::Header &header = cache->header();
+
+  // the axes are small, copy them so the lookup code keeps using vectors
+  z_map_.assign(cache->z_map(), cache->z_map() + header.nz);
+  r_map_.assign(cache->r_map(), cache->r_map() + header.nr);
+  phi_map_.assign(cache->phi_map(), cache->phi_map() + header.nphi);
+  minz_ = header.minz;
+  maxz_ = header.maxz;
+
+  BFieldZ_ = cache->bz();
+  BFieldR_ = cache->br();
+  BFieldPHI_ = cache->bphi();
+  m_cache = std::move(cache);
+  return true;
+}
+
+bool PHField3DCylindrical::WriteCache() const
+{
+  if (m_cache)
+  {
+    return true;
+  }
+  PHFieldMapCache::Header header;
+  header.ndim = 3;
+  header.field_unit = gauss;
+  header.minz = minz_;
+  header.maxz = maxz_;
+  const bool written = PHFieldMapCache::write(m_filename, header, z_map_, r_map_, phi_map_, BFieldZ_, BFieldR_, BFieldPHI_);
+  if (Verbosity() > 0)
+  {
+    std::cout << "PHField3DCylindrical::WriteCache - "
+              << (written ? "wrote " : "could not write ")
+              << PHFieldMapCache::cache_filename(m_filename) << std::endl;
+  }
+  return written;
+}
+
 void PHField3DCylindrical::GetFieldValue(const double point[4], double *Bfield) const
 {
   if (Verbosity() > 2)
@@ -370,32 +437,32 @@ void PHField3DCylindrical::GetFieldCyl(const double CylPoint[4], double *BfieldC
   assert(phi_index0 < (int) phi_map_.size());
   assert(phi_index1 >= 0);
 
-  double Br000 = BFieldR_[z_index0][r_index0][phi_index0];
-  double Br001 = BFieldR_[z_index0][r_index0][phi_index1];
-  double Br010 = BFieldR_[z_index0][r_index1][phi_index0];
-  double Br011 = BFieldR_[z_index0][r_index1][phi_index1];
-  double Br100 = BFieldR_[z_index1][r_index0][phi_index0];
-  double Br101 = BFieldR_[z_index1][r_index0][phi_index1];
-  double Br110 = BFieldR_[z_index1][r_index1][phi_index0];
-  double Br111 = BFieldR_[z_index1][r_index1][phi_index1];
-
-  double Bphi000 = BFieldPHI_[z_index0][r_index0][phi_index0];
-  double Bphi001 = BFieldPHI_[z_index0][r_index0][phi_index1];
-  double Bphi010 = BFieldPHI_[z_index0][r_index1][phi_index0];
-  double Bphi011 = BFieldPHI_[z_index0][r_index1][phi_index1];
-  double Bphi100 = BFieldPHI_[z_index1][r_index0][phi_index0];
-  double Bphi101 = BFieldPHI_[z_index1][r_index0][phi_index1];
-  double Bphi110 = BFieldPHI_[z_index1][r_index1][phi_index0];
-  double Bphi111 = BFieldPHI_[z_index1][r_index1][phi_index1];
-
-  double Bz000 = BFieldZ_[z_index0][r_index0][phi_index0];
-  double Bz001 = BFieldZ_[z_index0][r_index0][phi_index1];
-  double Bz100 = BFieldZ_[z_index1][r_index0][phi_index0];
-  double Bz101 = BFieldZ_[z_index1][r_index0][phi_index1];
-  double Bz010 = BFieldZ_[z_index0][r_index1][phi_index0];
-  double Bz110 = BFieldZ_[z_index1][r_index1][phi_index0];
-  double Bz011 = BFieldZ_[z_index0][r_index1][phi_index1];
-  double Bz111 = BFieldZ_[z_index1][r_index1][phi_index1];
+  double Br000 = BFieldR_[index(z_index0, r_index0, phi_index0)];
+  double Br001 = BFieldR_[index(z_index0, r_index0, phi_index1)];
+  double Br010 = BFieldR_[index(z_index0, r_index1, phi_index0)];
+  double Br011 = BFieldR_[index(z_index0, r_index1, phi_index1)];
+  double Br100 = BFieldR_[index(z_index1, r_index0, phi_index0)];
+  double Br101 = BFieldR_[index(z_index1, r_index0, phi_index1)];
+  double Br110 = BFieldR_[index(z_index1, r_index1, phi_index0)];
+  double Br111 = BFieldR_[index(z_index1, r_index1, phi_index1)];
+
+  double Bphi000 = BFieldPHI_[index(z_index0, r_index0, phi_index0)];
+  double Bphi001 = BFieldPHI_[index(z_index0, r_index0, phi_index1)];
+  double Bphi010 = BFieldPHI_[index(z_index0, r_index1, phi_index0)];
+  double Bphi011 = BFieldPHI_[index(z_index0, r_index1, phi_index1)];
+  double Bphi100 = BFieldPHI_[index(z_index1, r_index0, phi_index0)];
+  double Bphi101 = BFieldPHI_[index(z_index1, r_index0, phi_index1)];
+  double Bphi110 = BFieldPHI_[index(z_index1, r_index1, phi_index0)];
+  double Bphi111 = BFieldPHI_[index(z_index1, r_index1, phi_index1)];
+
+  double Bz000 = BFieldZ_[index(z_index0, r_index0, phi_index0)];
+  double Bz001 = BFieldZ_[index(z_index0, r_index0, phi_index1)];
+  double Bz100 = BFieldZ_[index(z_index1, r_index0, phi_index0)];
+  double Bz101 = BFieldZ_[index(z_index1, r_index0, phi_index1)];
+  double Bz010 = BFieldZ_[index(z_index0, r_index1, phi_index0)];
+  double Bz110 = BFieldZ_[index(z_index1, r_index1, phi_index0)];
+  double Bz011 = BFieldZ_[index(z_index0, r_index1, phi_index1)];
+  double Bz111 = BFieldZ_[index(z_index1, r_index1, phi_index1)];
 
   double zweight = z - z_map_[z_index0];
   double zspacing = z_map_[z_index1] - z_map_[z_index0];
@@ -434,6 +501,10 @@ void PHField3DCylindrical::GetFieldCyl(const double CylPoint[4], double *BfieldC
       zweight * ((1 - rweight) * ((1 - phiweight) * Bphi100 + phiweight * Bphi101) +
                  rweight * ((1 - phiweight) * Bphi110 + phiweight * Bphi111));
 
+  BfieldCyl[0] *= m_magfield_rescale;
+  BfieldCyl[1] *= m_magfield_rescale;
+  BfieldCyl[2] *= m_magfield_rescale;
+
   //     std::cout << "wr: " << rweight << " wz: " << zweight << " wphi: " << phiweight << std::endl;
   //     std::cout << "Bz000: " << Bz000 << std::endl
   //          << "Bz001: " << Bz001 << std::endl
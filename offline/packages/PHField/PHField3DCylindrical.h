@@ -22,26 +22,39 @@
 
 #include "PHField.h"
 
+#include <cstddef>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
 
+class PHFieldMapCache;
+
 class PHField3DCylindrical : public PHField
 {
   typedef std::tuple<float, float, float> trio;
 
  public:
   PHField3DCylindrical(const std::string& filename, int verb = 0, const float magfield_rescale = 1.0);
-  ~PHField3DCylindrical() override {}
+  ~PHField3DCylindrical() override;
   void GetFieldValue(const double Point[4], double* Bfield) const override;
   void GetFieldCyl(const double CylPoint[4], double* Bfield) const;
 
+  //! write the binary cache of this map (see PHFieldMapCache), true if it was written or is already in use
+  bool WriteCache() const;
+
  protected:
-  // < i, j, k > , this allows i and i+1 to be neighbors ( <i,j,k>=<z,r,phi> )
-  std::vector<std::vector<std::vector<float> > > BFieldZ_;
-  std::vector<std::vector<std::vector<float> > > BFieldR_;
-  std::vector<std::vector<std::vector<float> > > BFieldPHI_;
+  //! flat index into the field arrays, this allows i and i+1 to be neighbors ( <i,j,k>=<z,r,phi> )
+  size_t index(const unsigned int iz, const unsigned int ir, const unsigned int iphi) const
+  {
+    return (iz * r_map_.size() + ir) * phi_map_.size() + iphi;
+  }
+
+  //! field components, without magfield rescale. Point either to m_field_storage or into the mapped cache
+  const float* BFieldZ_ = nullptr;
+  const float* BFieldR_ = nullptr;
+  const float* BFieldPHI_ = nullptr;
 
   // maps indices to values z_map[i] = z_value that corresponds to ith index
   std::vector<float> z_map_;    // < i >
@@ -50,7 +63,20 @@ class PHField3DCylindrical : public PHField
 
   float maxz_, minz_;  // boundaries of magnetic field map cyl
 
+  float m_magfield_rescale = 1.;
+
  private:
+  //! map the binary cache of filename, false if there is no valid one
+  bool ReadCache(const std::string& filename);
+
+  std::string m_filename;
+
+  //! field values when parsed from the ROOT file
+  std::vector<float> m_field_storage;
+
+  //! mapped binary cache
+  std::unique_ptr<PHFieldMapCache> m_cache;
+
   bool bin_search(const std::vector<float>& vec, unsigned start, unsigned end, const float& key, unsigned& index) const;
   void print_map(std::map<trio, trio>::iterator& it) const;
 };
@@ -0,0 +1,161 @@
+#include "PHFieldMapCache.h"
+
+#include <fcntl.h>  // for open, O_RDONLY
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>  // for close, getpid
+
+#include <cstdio>   // for std::rename, std::remove
+#include <cstdlib>  // for getenv
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+static_assert(sizeof(PHFieldMapCache::Header) == 64, "PHFieldMapCache::Header layout changed, bump kVersion");
+
+PHFieldMapCache::~PHFieldMapCache()
+{
+  if (m_mapping)
+  {
+    munmap(m_mapping, m_mapping_size);
+  }
+}
+
+std::string PHFieldMapCache::cache_filename(const std::string &source)
+{
+  const char *cachedir = getenv("PHFIELD_CACHE_DIR");
+  if (!cachedir)
+  {
+    return source + ".fmap";
+  }
+  std::string basename = source;
+  const auto pos = basename.find_last_of('/');
+  if (pos != std::string::npos)
+  {
+    basename = basename.substr(pos + 1);
+  }
+  return std::string(cachedir) + "/" + basename + ".fmap";
+}
+
+bool PHFieldMapCache::source_stamp(const std::string &source, uint64_t &size, int64_t &mtime)
+{
+  struct stat st
+  {
+  };
+  if (stat(source.c_str(), &st) != 0)
+  {
+    return false;
+  }
+  size = st.st_size;
+  mtime = st.st_mtime;
+  return true;
+}
+
+bool PHFieldMapCache::open(const std::string &source, const unsigned int ndim)
+{
+  uint64_t source_size = 0;
+  int64_t source_mtime = 0;
+  if (!source_stamp(source, source_size, source_mtime))
+  {
+    return false;
+  }
+
+  const std::string filename = cache_filename(source);
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat st
+  {
+  };
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(Header))
+  {
+    close(fd);
+    return false;
+  }
+
+  // read only and shared, all jobs on a node use the same page cache copy
+  void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+  {
+    return false;
+  }
+
+  const Header *header = static_cast<const Header *>(mapping);
+  const Header reference;
+  const size_t n = (size_t) header->nz * header->nr * header->nphi;
+  const size_t nfields = (ndim == 3) ? 3 : 2;
+  const size_t expected_size = sizeof(Header) + sizeof(float) * (header->nz + header->nr + header->nphi + nfields * n);
+  if (std::memcmp(header->magic, reference.magic, sizeof(reference.magic)) != 0 ||
+      header->version != kVersion ||
+      header->ndim != ndim ||
+      header->source_size != source_size ||
+      header->source_mtime != source_mtime ||
+      n == 0 ||
+      (size_t) st.st_size != expected_size)
+  {
+    munmap(mapping, st.st_size);
+    return false;
+  }
+
+  m_mapping = mapping;
+  m_mapping_size = st.st_size;
+  m_header = header;
+
+  const float *data = reinterpret_cast<const float *>(static_cast<const char *>(mapping) + sizeof(Header));
+  m_z = data;
+  m_r = m_z + header->nz;
+  m_phi = m_r + header->nr;
+  m_bz = m_phi + header->nphi;
+  m_br = m_bz + n;
+  m_bphi = (ndim == 3) ? m_br + n : nullptr;
+  return true;
+}
+
+bool PHFieldMapCache::write(const std::string &source, Header header,
+                            const std::vector<float> &z, const std::vector<float> &r, const std::vector<float> &phi,
+                            const float *bz, const float *br, const float *bphi)
+{
+  if (!source_stamp(source, header.source_size, header.source_mtime))
+  {
+    return false;
+  }
+  header.nz = z.size();
+  header.nr = r.size();
+  header.nphi = phi.size();
+  const size_t n = (size_t) header.nz * header.nr * header.nphi;
+
+  const std::string filename = cache_filename(source);
+  const std::string tmpfilename = filename + ".tmp" + std::to_string(getpid());
+  {
+    std::ofstream out(tmpfilename, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      return false;
+    }
+    out.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    out.write(reinterpret_cast<const char *>(z.data()), sizeof(float) * z.size());
+    out.write(reinterpret_cast<const char *>(r.data()), sizeof(float) * r.size());
+    out.write(reinterpret_cast<const char *>(phi.data()), sizeof(float) * phi.size());
+    out.write(reinterpret_cast<const char *>(bz), sizeof(float) * n);
+    out.write(reinterpret_cast<const char *>(br), sizeof(float) * n);
+    if (header.ndim == 3)
+    {
+      out.write(reinterpret_cast<const char *>(bphi), sizeof(float) * n);
+    }
+    if (!out)
+    {
+      out.close();
+      std::remove(tmpfilename.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmpfilename.c_str(), filename.c_str()) != 0)
+  {
+    std::remove(tmpfilename.c_str());
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,94 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef PHFIELD_PHFIELDMAPCACHE_H
+#define PHFIELD_PHFIELDMAPCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//! read-only, memory mapped binary copy of a cylindrical field map
+/*!
+ * The cache holds the sorted grid axes and the field components of a
+ * PHField2D or PHField3DCylindrical map in Geant4 units, flat in
+ * (z, r, phi) order, with phi running fastest. The magfield rescale is
+ * not applied so the same cache serves every rescale value.
+ *
+ * Layout: Header, then the float arrays z[nz], r[nr], phi[nphi], bz[n],
+ * br[n] and (3D only) bphi[n], with n = nz*nr*nphi (nphi = 1 for 2D maps).
+ *
+ * The cache is tied to its ROOT source through the source file size and
+ * modification time and is ignored when either changed. By default it is
+ * written next to the source as <source>.fmap, the PHFIELD_CACHE_DIR
+ * environment variable redirects it to another directory.
+ */
+class PHFieldMapCache
+{
+ public:
+  //! bump when the layout changes, older caches are then ignored
+  static constexpr uint32_t kVersion = 1;
+
+  struct Header
+  {
+    char magic[8] = {'P', 'H', 'F', 'M', 'A', 'P', '\0', '\0'};
+    uint32_t version = kVersion;
+    uint32_t ndim = 0;
+    uint32_t nz = 0;
+    uint32_t nr = 0;
+    uint32_t nphi = 0;
+    uint32_t reserved = 0;
+    uint64_t source_size = 0;
+    int64_t source_mtime = 0;
+    double field_unit = 0;
+    float minz = 0;
+    float maxz = 0;
+  };
+
+  PHFieldMapCache() = default;
+  ~PHFieldMapCache();
+
+  // owns a mapping, no copies
+  PHFieldMapCache(const PHFieldMapCache &) = delete;
+  PHFieldMapCache &operator=(const PHFieldMapCache &) = delete;
+
+  //! cache file name used for a given ROOT field map
+  static std::string cache_filename(const std::string &source);
+
+  //! map the cache of source, false if it is missing, stale or not a ndim map
+  bool open(const std::string &source, const unsigned int ndim);
+
+  //! write a cache for source. Goes through a temporary file and rename so concurrent jobs never see a partial cache
+  static bool write(const std::string &source, Header header,
+                    const std::vector<float> &z, const std::vector<float> &r, const std::vector<float> &phi,
+                    const float *bz, const float *br, const float *bphi);
+
+  const Header &header() const { return *m_header; }
+
+  ///@name mapped arrays
+  //@{
+  const float *z_map() const { return m_z; }
+  const float *r_map() const { return m_r; }
+  const float *phi_map() const { return m_phi; }
+  const float *bz() const { return m_bz; }
+  const float *br() const { return m_br; }
+  const float *bphi() const { return m_bphi; }
+  //@}
+
+ private:
+  //! size and modification time of source, false if it cannot be stat'ed
+  static bool source_stamp(const std::string &source, uint64_t &size, int64_t &mtime);
+
+  void *m_mapping = nullptr;
+  size_t m_mapping_size = 0;
+
+  const Header *m_header = nullptr;
+  const float *m_z = nullptr;
+  const float *m_r = nullptr;
+  const float *m_phi = nullptr;
+  const float *m_bz = nullptr;
+  const float *m_br = nullptr;
+  const float *m_bphi = nullptr;
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include "PHField3DCartesian.h"
 #include "PHField3DCylindrical.h"
 #include "PHFieldInterpolated.h"
+#include "PHFieldMapCache.h"
 #include "PHFieldConfig.h"
 #include "PHFieldConfigv1.h"
 #include "PHFieldUniform.h"
@@ -99,6 +100,36 @@ PHFieldUtility::BuildFieldMap(const PHFieldConfig *field_config, float inner_rad
   return field;
 }
 
+bool PHFieldUtility::BuildFieldMapCache(const PHFieldConfig *field_config, const int verbosity)
+{
+  assert(field_config);
+
+  bool written = false;
+  switch (field_config->get_field_config())
+  {
+  case PHFieldConfig::kField2D:
+  {
+    PHField2D field(field_config->get_filename(), verbosity, field_config->get_magfield_rescale());
+    written = field.WriteCache();
+    break;
+  }
+  case PHFieldConfig::kField3DCylindrical:
+  {
+    PHField3DCylindrical field(field_config->get_filename(), verbosity, field_config->get_magfield_rescale());
+    written = field.WriteCache();
+    break;
+  }
+  default:
+    std::cout << "PHFieldUtility::BuildFieldMapCache - no binary cache for field configuration: " << field_config->get_field_config() << std::endl;
+    return false;
+  }
+  if (!written)
+  {
+    std::cout << "PHFieldUtility::BuildFieldMapCache - could not write " << PHFieldMapCache::cache_filename(field_config->get_filename()) << std::endl;
+  }
+  return written;
+}
+
 //! Make a default PHFieldConfig
 //! Field map = /phenix/upgrades/decadal/fieldmaps/sPHENIX.2d.root
 //! Field Scale to 1.4/1.5
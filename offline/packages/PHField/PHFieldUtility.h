@@ -33,6 +33,12 @@ class PHFieldUtility
   static PHField *
   BuildFieldMap(const PHFieldConfig *field_config, float inner_radius = 0., float outer_radius = 1.e10, float size_z = 1.e10, const int verbosity = 0);
 
+  //! Generate the binary cache of a kField2D or kField3DCylindrical map, later BuildFieldMap calls mmap it instead of parsing the ROOT file
+  //! The cache goes next to the map or into $PHFIELD_CACHE_DIR, see PHFieldMapCache
+  //! \return true if the cache was written or was already up to date
+  static bool
+  BuildFieldMapCache(const PHFieldConfig *field_config, const int verbosity = 0);
+
   //! DST node name for RunTime field map object
   static std::string
   GetDSTFieldMapNodeName()
@@ -11,13 +11,20 @@
 #include <trackbase/ClusterErrorPara.h>
 #include <trackbase/TrackFitUtils.h>
 
+#include <trackbase_historic/SvtxAlignmentStateMap.h>
+
 #include <phparameter/PHParameterInterface.h>
 #include <tpc/TpcClusterZCrossingCorrection.h>
 
 #include <fun4all/SubsysReco.h>
 
+#include <phool/PHTimer.h>
+
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 class TpcClusterZCrossingCorrection;
 class PHCompositeNode;
@@ -33,6 +40,7 @@ class SvtxTrackMap;
 class SvtxVertexMap;
 class SvtxAlignmentStateMap;
 class SvtxTrack;
+class SvtxTrack_v4;
 
 class HelicalFitter : public SubsysReco, public PHParameterInterface
 {
@@ -112,9 +120,49 @@ class HelicalFitter : public SubsysReco, public PHParameterInterface
 
   void set_dca_cut(float dca) { dca_cut = dca; }
 
+  //! number of OpenMP threads computing the derivatives and Mille records of
+  //! the accepted tracks. The output does not depend on it, Verbosity() > 1
+  //! forces a single thread
+  void set_num_threads(int value) { m_num_threads = value; }
+  void set_make_ntuple(bool flag) { make_ntuple = flag; }
+
  private:
   Mille* _mille;
 
+  //! event wide quantities used for the records of all accepted tracks
+  struct EventSummary
+  {
+    unsigned int accepted_tracks{0};
+    Acts::Vector3 average_vertex{0, 0, 0};
+    unsigned int nsilicon{0};
+    unsigned int ntpc{0};
+    unsigned int nclus{0};
+    bool h2h_flag{false};
+  };
+
+  //! everything one accepted track produces. The tracks are processed
+  //! independently and published in track order by publishTrackRecord
+  struct TrackRecord
+  {
+    SvtxAlignmentStateMap::StateVec statevec;
+    std::string mille_record;
+    //! cluster ntuple rows, the ideal geometry columns are filled on publishing
+    std::vector<std::vector<float>> cluster_rows;
+    //! surface and local position (cm) of the cluster of each row
+    std::vector<std::pair<Surface, Acts::Vector3>> cluster_ideal_input;
+    std::vector<float> track_row;
+  };
+
+  //! inverse surface transforms, per thread and event
+  using TransformCache = std::unordered_map<const Acts::Surface*, Acts::Transform3>;
+
+  void makeTrackRecord(unsigned int trackid, const EventSummary& summary,
+                       const std::vector<Acts::Vector3>& global_vec, const std::vector<TrkrDefs::cluskey>& cluskey_vec,
+                       std::vector<float> fitpars, std::vector<float> fitpars_mvtx_half,
+                       const TrackSeed& someseed, SvtxTrack_v4& newTrack,
+                       Mille& mille, TransformCache& transforms, TrackRecord& record);
+  void publishTrackRecord(unsigned int trackid, SvtxTrack_v4& newTrack, TrackRecord& record);
+
   int GetNodes(PHCompositeNode* topNode);
   int CreateNodes(PHCompositeNode* topNode);
   void getTrackletClusterList(TrackSeed* tracklet, std::vector<TrkrDefs::cluskey>& cluskey_vec);
@@ -228,6 +276,10 @@ class HelicalFitter : public SubsysReco, public PHParameterInterface
 
   int event{0};
 
+  int m_num_threads{1};
+  unsigned long m_nrecords{0};
+  PHTimer m_record_timer{"HelicalFitterRecordTimer"};
+
   Acts::Vector3 vertexPosition;
   Acts::Vector3 vertexPosUncertainty;
   Acts::Vector2 vtx_sigma;
@@ -33,6 +33,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <utility>
 
 //___________________________________________________________________________
 
@@ -44,6 +45,7 @@
  */
 Mille::Mille(const char *outFileName, bool asBinary, bool writeZero)
   : myOutFile(outFileName, (asBinary ? (std::ios::binary | std::ios::out) : std::ios::out))
+  , myToMemory(false)
   , myAsBinary(asBinary)
   , myWriteZero(writeZero)
   , myBufferPos(-1)
@@ -61,6 +63,27 @@ Mille::Mille(const char *outFileName, bool asBinary, bool writeZero)
   }
 }
 
+//___________________________________________________________________________
+
+/// Collects the records in memory, to be written with writeRecords() of a Mille with a file.
+/**
+ * Records are written in the same format as to a file, i.e. records taken from
+ * several memory Milles and written in a fixed order give the same file as
+ * writing them directly in that order.
+ * \param[in] asBinary     flag for binary
+ * \param[in] writeZero    flag for keeping of zeros
+ */
+Mille::Mille(bool asBinary, bool writeZero)
+  : myToMemory(true)
+  , myAsBinary(asBinary)
+  , myWriteZero(writeZero)
+  , myBufferPos(-1)
+  , myHasSpecial(false)
+{
+  myBufferInt[0] = 0;
+  myBufferFloat[0] = 0.;
+}
+
 //___________________________________________________________________________
 /// Closes file.
 Mille::~Mille()
@@ -204,30 +227,31 @@ void Mille::end()
   if (myBufferPos > 0)
   {  // only if anything stored...
     const int numWordsToWrite = (myBufferPos + 1) * 2;
+    std::ostream &out = myToMemory ? static_cast<std::ostream &>(myRecords) : myOutFile;
 
     if (myAsBinary)
     {
-      myOutFile.write(reinterpret_cast<const char *>(&numWordsToWrite),
-                      sizeof(numWordsToWrite));
-      myOutFile.write(reinterpret_cast<char *>(myBufferFloat),
-                      (myBufferPos + 1) * sizeof(myBufferFloat[0]));
-      myOutFile.write(reinterpret_cast<char *>(myBufferInt),
-                      (myBufferPos + 1) * sizeof(myBufferInt[0]));
+      out.write(reinterpret_cast<const char *>(&numWordsToWrite),
+                sizeof(numWordsToWrite));
+      out.write(reinterpret_cast<char *>(myBufferFloat),
+                (myBufferPos + 1) * sizeof(myBufferFloat[0]));
+      out.write(reinterpret_cast<char *>(myBufferInt),
+                (myBufferPos + 1) * sizeof(myBufferInt[0]));
     }
     else
     {
-      myOutFile << numWordsToWrite << "\n";
+      out << numWordsToWrite << "\n";
       for (int i = 0; i < myBufferPos + 1; ++i)
       {
-        myOutFile << myBufferFloat[i] << " ";
+        out << myBufferFloat[i] << " ";
       }
-      myOutFile << "\n";
+      out << "\n";
 
       for (int i = 0; i < myBufferPos + 1; ++i)
       {
-        myOutFile << myBufferInt[i] << " ";
+        out << myBufferInt[i] << " ";
       }
-      myOutFile << "\n";
+      out << "\n";
     }
   }
   myBufferPos = -1;  // reset buffer for next set of derivatives
@@ -235,6 +259,25 @@ void Mille::end()
   //  std:: cout << " Mille::end() finished with myBufferPos " << myBufferPos << std::endl;
 }
 
+//___________________________________________________________________________
+/// Take the records collected in memory, the buffer is empty afterwards.
+std::string Mille::takeRecords()
+{
+  std::string records = std::move(myRecords).str();
+  myRecords.str(std::string());
+  return records;
+}
+
+//___________________________________________________________________________
+/// Write records taken from a memory Mille (with the same format) to the file.
+/**
+ * \param[in] records  records as returned by takeRecords()
+ */
+void Mille::writeRecords(const std::string &records)
+{
+  myOutFile.write(records.data(), records.size());
+}
+
 //___________________________________________________________________________
 /// Initialize for new set of locals, e.g. new track.
 void Mille::newSet()
@@ -26,6 +26,8 @@
 #include <climits>
 #include <fstream>
 #include <limits>
+#include <sstream>
+#include <string>
 /**
  * \class Mille
  *
@@ -52,6 +54,8 @@ class Mille
 {
  public:
   Mille(const char *outFileName, bool asBinary = true, bool writeZero = false);
+  /// collect the records in memory instead of writing them to a file
+  explicit Mille(bool asBinary = true, bool writeZero = false);
   ~Mille();
 
   void mille(int NLC, const float *derLc, int NGL, const float *derGl,
@@ -60,11 +64,18 @@ class Mille
   void kill();
   void end();
 
+  /// hand over the records collected in memory since the last call
+  std::string takeRecords();
+  /// write records taken from a Mille collecting in memory to the file
+  void writeRecords(const std::string &records);
+
  private:
   void newSet();
   bool checkBufferSize(int nLocal, int nGlobal);
 
-  std::ofstream myOutFile;  ///< C-binary for output
+  std::ofstream myOutFile;       ///< C-binary for output
+  std::ostringstream myRecords;  ///< records collected in memory
+  bool myToMemory;               ///< if true collect records in myRecords
   bool myAsBinary;          ///< if false output as text
   bool myWriteZero;         ///< if true also write out derivatives/labels ==0
   /// buffer size for ints and floats
@@ -0,0 +1,69 @@
+#include "DiagnosticNtuple.h"
+
+#include <TNtuple.h>
+
+#include <cassert>
+#include <sstream>
+
+DiagnosticNtuple::DiagnosticNtuple(const std::string &name, const std::string &title,
+                                   const std::string &varlist, const std::set<std::string> &dropped)
+{
+  std::string written;
+  std::istringstream stream(varlist);
+  std::string column;
+  while (std::getline(stream, column, ':'))
+  {
+    if (dropped.contains(column))
+    {
+      m_target.push_back(-1);
+      continue;
+    }
+    m_target.push_back(m_row.size());
+    m_row.push_back(0);
+    if (!written.empty())
+    {
+      written += ":";
+    }
+    written += column;
+  }
+  m_ntuple = new TNtuple(name.c_str(), title.c_str(), written.c_str());
+}
+
+void DiagnosticNtuple::Fill(std::initializer_list<std::span<const float>> blocks)
+{
+  unsigned int column = 0;
+  for (const auto &block : blocks)
+  {
+    assert(column + block.size() <= m_target.size());
+    for (const float value : block)
+    {
+      const int target = m_target[column++];
+      if (target >= 0)
+      {
+        m_row[target] = value;
+      }
+    }
+  }
+  assert(column == m_target.size());
+  m_ntuple->Fill(m_row.data());
+}
+
+int DiagnosticNtuple::Write()
+{
+  return m_ntuple->Write();
+}
+
+std::set<std::string> DiagnosticNtuple::split(const std::string &columns)
+{
+  std::set<std::string> result;
+  std::istringstream stream(columns);
+  std::string column;
+  while (std::getline(stream, column, ':'))
+  {
+    if (!column.empty())
+    {
+      result.insert(column);
+    }
+  }
+  return result;
+}
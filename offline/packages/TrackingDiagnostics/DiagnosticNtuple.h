@@ -0,0 +1,53 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef TRACKINGDIAGNOSTICS_DIAGNOSTICNTUPLE_H
+#define TRACKINGDIAGNOSTICS_DIAGNOSTICNTUPLE_H
+
+#include <initializer_list>
+#include <set>
+#include <span>
+#include <string>
+#include <vector>
+
+class TNtuple;
+
+/**
+ * @brief TNtuple of the tracking diagnostics with run time column selection
+ *
+ * The rows are given as the consecutive float blocks the modules fill
+ * anyway (event, hit/cluster/track, info ...), in the order of the full
+ * varlist. Only the columns which are not dropped become branches, the
+ * values are copied directly from the blocks into the row buffer, no
+ * per row allocations or copies of the complete row.
+ * The output is a regular TNtuple, existing macros keep working.
+ */
+class DiagnosticNtuple
+{
+ public:
+  /// varlist as for TNtuple ("a:b:c"), columns in dropped are not written
+  DiagnosticNtuple(const std::string &name, const std::string &title,
+                   const std::string &varlist, const std::set<std::string> &dropped = {});
+
+  /// fill one row, the blocks together have to hold all columns of the varlist
+  void Fill(std::initializer_list<std::span<const float>> blocks);
+
+  /// write the ntuple to the current directory
+  int Write();
+
+  TNtuple *ntuple() const { return m_ntuple; }
+
+  /// number of columns of the full varlist and of the written ntuple
+  unsigned int ncolumns() const { return m_target.size(); }
+  unsigned int nwritten() const { return m_row.size(); }
+
+  /// split a colon separated column list
+  static std::set<std::string> split(const std::string &columns);
+
+ private:
+  TNtuple *m_ntuple{nullptr};
+  /// for each column of the varlist its index in m_row, -1 if dropped
+  std::vector<int> m_target;
+  std::vector<float> m_row;
+};
+
+#endif
@@ -1,6 +1,8 @@
 
 #include "TrackResiduals.h"
 
+#include "DiagnosticNtuple.h"
+
 #include <trackbase/ClusterErrorPara.h>
 #include <trackbase/InttDefs.h>
 #include <trackbase/MvtxDefs.h>
@@ -58,6 +60,7 @@
 #include <phool/PHNodeIterator.h>
 #include <phool/getClass.h>
 
+#include <TROOT.h>
 #include <TSystem.h>
 
 #include <cmath>
@@ -107,7 +110,16 @@ TrackResiduals::TrackResiduals(const std::string& name)
 //____________________________________________________________________________..
 int TrackResiduals::InitRun(PHCompositeNode* topNode)
 {
+  // implicit MT has to be on before the trees are created
+  if (m_compressionThreads > 0 && !ROOT::IsImplicitMTEnabled())
+  {
+    ROOT::EnableImplicitMT(m_compressionThreads);
+  }
   m_outfile = new TFile(m_outfileName.c_str(), "RECREATE");
+  if (m_compressionSetting >= 0)
+  {
+    m_outfile->SetCompressionSettings(m_compressionSetting);
+  }
   createBranches();
 
   // global position wrapper
@@ -123,6 +135,12 @@ int TrackResiduals::InitRun(PHCompositeNode* topNode)
 
   return Fun4AllReturnCodes::EVENT_OK;
 }
+void TrackResiduals::dropBranches(const std::string& branches)
+{
+  const auto dropped = DiagnosticNtuple::split(branches);
+  m_droppedBranches.insert(dropped.begin(), dropped.end());
+}
+
 void TrackResiduals::clearClusterStateVectors()
 {
   m_cluskeys.clear();
@@ -1604,301 +1622,301 @@ void TrackResiduals::createBranches()
   if (m_doEventTree)
   {
     m_eventtree = new TTree("eventtree", "A tree with all hits");
-    m_eventtree->Branch("run", &m_runnumber, "m_runnumber/I");
-    m_eventtree->Branch("segment", &m_segment, "m_segment/I");
-    m_eventtree->Branch("event", &m_event, "m_event/I");
-    m_eventtree->Branch("gl1bco", &m_bco, "m_bco/I");
-    m_eventtree->Branch("nmvtx", &m_nmvtx_all, "m_nmvtx_all/I");
-    m_eventtree->Branch("nintt", &m_nintt_all, "m_nintt_all/I");
-    m_eventtree->Branch("nhittpc0", &m_ntpc_hits0, "m_ntpc_hits0/I");
-    m_eventtree->Branch("nhittpc1", &m_ntpc_hits1, "m_ntpc_hits1/I");
-    m_eventtree->Branch("nclustpc0", &m_ntpc_clus0, "m_ntpc_clus0/I");
-    m_eventtree->Branch("nclustpc1", &m_ntpc_clus1, "m_ntpc_clus1/I");
-    m_eventtree->Branch("nmms", &m_nmms_all, "m_nmms_all/I");
-    m_eventtree->Branch("nsiseed", &m_nsiseed, "m_nsiseed/I");
-    m_eventtree->Branch("ntpcseed", &m_ntpcseed, "m_ntpcseed/I");
-    m_eventtree->Branch("ntracks", &m_ntracks_all, "m_ntracks_all/I");
-    m_eventtree->Branch("mbdcharge",&m_totalmbd, "m_totalmbd/F");
-    m_eventtree->Branch("ntpcClusSector", &m_ntpc_clus_sector);
+    addBranch(m_eventtree, "run", &m_runnumber, "m_runnumber/I");
+    addBranch(m_eventtree, "segment", &m_segment, "m_segment/I");
+    addBranch(m_eventtree, "event", &m_event, "m_event/I");
+    addBranch(m_eventtree, "gl1bco", &m_bco, "m_bco/I");
+    addBranch(m_eventtree, "nmvtx", &m_nmvtx_all, "m_nmvtx_all/I");
+    addBranch(m_eventtree, "nintt", &m_nintt_all, "m_nintt_all/I");
+    addBranch(m_eventtree, "nhittpc0", &m_ntpc_hits0, "m_ntpc_hits0/I");
+    addBranch(m_eventtree, "nhittpc1", &m_ntpc_hits1, "m_ntpc_hits1/I");
+    addBranch(m_eventtree, "nclustpc0", &m_ntpc_clus0, "m_ntpc_clus0/I");
+    addBranch(m_eventtree, "nclustpc1", &m_ntpc_clus1, "m_ntpc_clus1/I");
+    addBranch(m_eventtree, "nmms", &m_nmms_all, "m_nmms_all/I");
+    addBranch(m_eventtree, "nsiseed", &m_nsiseed, "m_nsiseed/I");
+    addBranch(m_eventtree, "ntpcseed", &m_ntpcseed, "m_ntpcseed/I");
+    addBranch(m_eventtree, "ntracks", &m_ntracks_all, "m_ntracks_all/I");
+    addBranch(m_eventtree, "mbdcharge",&m_totalmbd, "m_totalmbd/F");
+    addBranch(m_eventtree, "ntpcClusSector", &m_ntpc_clus_sector);
   }
 
   m_failedfits = new TTree("failedfits", "tree with seeds from failed Acts fits");
-  m_failedfits->Branch("run", &m_runnumber, "m_runnumber/I");
-  m_failedfits->Branch("segment", &m_segment, "m_segment/I");
-  m_failedfits->Branch("trackid", &m_trackid, "m_trackid/I");
-  m_failedfits->Branch("event", &m_event, "m_event/I");
-  m_failedfits->Branch("silseedx", &m_silseedx, "m_silseedx/F");
-  m_failedfits->Branch("silseedy", &m_silseedy, "m_silseedy/F");
-  m_failedfits->Branch("silseedz", &m_silseedz, "m_silseedz/F");
-  m_failedfits->Branch("tpcseedx", &m_tpcseedx, "m_tpcseedx/F");
-  m_failedfits->Branch("tpcseedy", &m_tpcseedy, "m_tpcseedy/F");
-  m_failedfits->Branch("tpcseedz", &m_tpcseedz, "m_tpcseedz/F");
-  m_failedfits->Branch("tpcseedpx", &m_tpcseedpx, "m_tpcseedpx/F");
-  m_failedfits->Branch("tpcseedpy", &m_tpcseedpy, "m_tpcseedpy/F");
-  m_failedfits->Branch("tpcseedpz", &m_tpcseedpz, "m_tpcseedpz/F");
-  m_failedfits->Branch("tpcseedcharge", &m_tpcseedcharge, "m_tpcseedcharge/I");
-  m_failedfits->Branch("dedx", &m_dedx, "m_dedx/F");
-  m_failedfits->Branch("nmaps", &m_nmaps, "m_nmaps/I");
-  m_failedfits->Branch("nintt", &m_nintt, "m_nintt/I");
-  m_failedfits->Branch("ntpc", &m_ntpc, "m_ntpc/I");
-  m_failedfits->Branch("nmms", &m_nmms, "m_nmms/I");
-  m_failedfits->Branch("gx", &m_clusgx);
-  m_failedfits->Branch("gy", &m_clusgy);
-  m_failedfits->Branch("gz", &m_clusgz);
-  m_failedfits->Branch("gr", &m_clusgr);
-  m_failedfits->Branch("lx", &m_cluslx);
-  m_failedfits->Branch("lz", &m_cluslz);
+  addBranch(m_failedfits, "run", &m_runnumber, "m_runnumber/I");
+  addBranch(m_failedfits, "segment", &m_segment, "m_segment/I");
+  addBranch(m_failedfits, "trackid", &m_trackid, "m_trackid/I");
+  addBranch(m_failedfits, "event", &m_event, "m_event/I");
+  addBranch(m_failedfits, "silseedx", &m_silseedx, "m_silseedx/F");
+  addBranch(m_failedfits, "silseedy", &m_silseedy, "m_silseedy/F");
+  addBranch(m_failedfits, "silseedz", &m_silseedz, "m_silseedz/F");
+  addBranch(m_failedfits, "tpcseedx", &m_tpcseedx, "m_tpcseedx/F");
+  addBranch(m_failedfits, "tpcseedy", &m_tpcseedy, "m_tpcseedy/F");
+  addBranch(m_failedfits, "tpcseedz", &m_tpcseedz, "m_tpcseedz/F");
+  addBranch(m_failedfits, "tpcseedpx", &m_tpcseedpx, "m_tpcseedpx/F");
+  addBranch(m_failedfits, "tpcseedpy", &m_tpcseedpy, "m_tpcseedpy/F");
+  addBranch(m_failedfits, "tpcseedpz", &m_tpcseedpz, "m_tpcseedpz/F");
+  addBranch(m_failedfits, "tpcseedcharge", &m_tpcseedcharge, "m_tpcseedcharge/I");
+  addBranch(m_failedfits, "dedx", &m_dedx, "m_dedx/F");
+  addBranch(m_failedfits, "nmaps", &m_nmaps, "m_nmaps/I");
+  addBranch(m_failedfits, "nintt", &m_nintt, "m_nintt/I");
+  addBranch(m_failedfits, "ntpc", &m_ntpc, "m_ntpc/I");
+  addBranch(m_failedfits, "nmms", &m_nmms, "m_nmms/I");
+  addBranch(m_failedfits, "gx", &m_clusgx);
+  addBranch(m_failedfits, "gy", &m_clusgy);
+  addBranch(m_failedfits, "gz", &m_clusgz);
+  addBranch(m_failedfits, "gr", &m_clusgr);
+  addBranch(m_failedfits, "lx", &m_cluslx);
+  addBranch(m_failedfits, "lz", &m_cluslz);
 
   m_vertextree = new TTree("vertextree", "tree with vertices");
-  m_vertextree->Branch("run", &m_runnumber, "m_runnumber/I");
-  m_vertextree->Branch("segment", &m_segment, "m_segment/I");
-  m_vertextree->Branch("event", &m_event, "m_event/I");
-  m_vertextree->Branch("firedTriggers", &m_firedTriggers);
-  m_vertextree->Branch("gl1BunchCrossing", &m_gl1BunchCrossing, "m_gl1BunchCrossing/l");
-  m_vertextree->Branch("gl1bco", &m_bco, "m_bco/l");
-  m_vertextree->Branch("trbco", &m_bcotr, "m_bcotr/l");
-  m_vertextree->Branch("vertexid", &m_vertexid);
-  m_vertextree->Branch("vertex_crossing", &m_vertex_crossing, "m_vertex_crossing/I");
-  m_vertextree->Branch("mbdzvtx", &m_mbdvtxz, "m_mbdvtxz/F");
-  m_vertextree->Branch("vx", &m_vx, "m_vx/F");
-  m_vertextree->Branch("vy", &m_vy, "m_vy/F");
-  m_vertextree->Branch("vz", &m_vz, "m_vz/F");
-  m_vertextree->Branch("ntracks", &m_ntracks, "m_ntracks/I");
-  m_vertextree->Branch("nvertices", &m_nvertices, "m_nvertices/I");
-  m_vertextree->Branch("gx", &m_clusgx);
-  m_vertextree->Branch("gy", &m_clusgy);
-  m_vertextree->Branch("gz", &m_clusgz);
-  m_vertextree->Branch("gr", &m_clusgr);
-  m_vertextree->Branch("mbdcharge", &m_totalmbd, "m_totalmbd/F");
+  addBranch(m_vertextree, "run", &m_runnumber, "m_runnumber/I");
+  addBranch(m_vertextree, "segment", &m_segment, "m_segment/I");
+  addBranch(m_vertextree, "event", &m_event, "m_event/I");
+  addBranch(m_vertextree, "firedTriggers", &m_firedTriggers);
+  addBranch(m_vertextree, "gl1BunchCrossing", &m_gl1BunchCrossing, "m_gl1BunchCrossing/l");
+  addBranch(m_vertextree, "gl1bco", &m_bco, "m_bco/l");
+  addBranch(m_vertextree, "trbco", &m_bcotr, "m_bcotr/l");
+  addBranch(m_vertextree, "vertexid", &m_vertexid);
+  addBranch(m_vertextree, "vertex_crossing", &m_vertex_crossing, "m_vertex_crossing/I");
+  addBranch(m_vertextree, "mbdzvtx", &m_mbdvtxz, "m_mbdvtxz/F");
+  addBranch(m_vertextree, "vx", &m_vx, "m_vx/F");
+  addBranch(m_vertextree, "vy", &m_vy, "m_vy/F");
+  addBranch(m_vertextree, "vz", &m_vz, "m_vz/F");
+  addBranch(m_vertextree, "ntracks", &m_ntracks, "m_ntracks/I");
+  addBranch(m_vertextree, "nvertices", &m_nvertices, "m_nvertices/I");
+  addBranch(m_vertextree, "gx", &m_clusgx);
+  addBranch(m_vertextree, "gy", &m_clusgy);
+  addBranch(m_vertextree, "gz", &m_clusgz);
+  addBranch(m_vertextree, "gr", &m_clusgr);
+  addBranch(m_vertextree, "mbdcharge", &m_totalmbd, "m_totalmbd/F");
 
   m_hittree = new TTree("hittree", "A tree with all hits");
-  m_hittree->Branch("run", &m_runnumber, "m_runnumber/I");
-  m_hittree->Branch("segment", &m_segment, "m_segment/I");
-  m_hittree->Branch("event", &m_event, "m_event/I");
-  m_hittree->Branch("gl1bco", &m_bco, "m_bco/l");
-  m_hittree->Branch("hitsetkey", &m_hitsetkey, "m_hitsetkey/i");
-  m_hittree->Branch("gx", &m_hitgx, "m_hitgx/F");
-  m_hittree->Branch("gy", &m_hitgy, "m_hitgy/F");
-  m_hittree->Branch("gz", &m_hitgz, "m_hitgz/F");
-  m_hittree->Branch("layer", &m_hitlayer, "m_hitlayer/I");
-  m_hittree->Branch("sector", &m_sector, "m_sector/I");
-  m_hittree->Branch("side", &m_side, "m_side/I");
-  m_hittree->Branch("stave", &m_staveid, "m_staveid/I");
-  m_hittree->Branch("chip", &m_chipid, "m_chipid/I");
-  m_hittree->Branch("strobe", &m_strobeid, "m_strobeid/I");
-  m_hittree->Branch("ladderz", &m_ladderzid, "m_ladderzid/I");
-  m_hittree->Branch("ladderphi", &m_ladderphiid, "m_ladderphiid/I");
-  m_hittree->Branch("timebucket", &m_timebucket, "m_timebucket/I");
-  m_hittree->Branch("pad", &m_hitpad, "m_hitpad/I");
-  m_hittree->Branch("tbin", &m_hittbin, "m_hittbin/I");
-  m_hittree->Branch("col", &m_col, "m_col/I");
-  m_hittree->Branch("row", &m_row, "m_row/I");
-  m_hittree->Branch("segtype", &m_segtype, "m_segtype/I");
-  m_hittree->Branch("tile", &m_tileid, "m_tileid/I");
-  m_hittree->Branch("strip", &m_strip, "m_strip/I");
-  m_hittree->Branch("adc", &m_adc, "m_adc/F");
-  m_hittree->Branch("zdriftlength", &m_zdriftlength, "m_zdriftlength/F");
-  m_hittree->Branch("mbdcharge",&m_totalmbd, "m_totalmbd/F");
+  addBranch(m_hittree, "run", &m_runnumber, "m_runnumber/I");
+  addBranch(m_hittree, "segment", &m_segment, "m_segment/I");
+  addBranch(m_hittree, "event", &m_event, "m_event/I");
+  addBranch(m_hittree, "gl1bco", &m_bco, "m_bco/l");
+  addBranch(m_hittree, "hitsetkey", &m_hitsetkey, "m_hitsetkey/i");
+  addBranch(m_hittree, "gx", &m_hitgx, "m_hitgx/F");
+  addBranch(m_hittree, "gy", &m_hitgy, "m_hitgy/F");
+  addBranch(m_hittree, "gz", &m_hitgz, "m_hitgz/F");
+  addBranch(m_hittree, "layer", &m_hitlayer, "m_hitlayer/I");
+  addBranch(m_hittree, "sector", &m_sector, "m_sector/I");
+  addBranch(m_hittree, "side", &m_side, "m_side/I");
+  addBranch(m_hittree, "stave", &m_staveid, "m_staveid/I");
+  addBranch(m_hittree, "chip", &m_chipid, "m_chipid/I");
+  addBranch(m_hittree, "strobe", &m_strobeid, "m_strobeid/I");
+  addBranch(m_hittree, "ladderz", &m_ladderzid, "m_ladderzid/I");
+  addBranch(m_hittree, "ladderphi", &m_ladderphiid, "m_ladderphiid/I");
+  addBranch(m_hittree, "timebucket", &m_timebucket, "m_timebucket/I");
+  addBranch(m_hittree, "pad", &m_hitpad, "m_hitpad/I");
+  addBranch(m_hittree, "tbin", &m_hittbin, "m_hittbin/I");
+  addBranch(m_hittree, "col", &m_col, "m_col/I");
+  addBranch(m_hittree, "row", &m_row, "m_row/I");
+  addBranch(m_hittree, "segtype", &m_segtype, "m_segtype/I");
+  addBranch(m_hittree, "tile", &m_tileid, "m_tileid/I");
+  addBranch(m_hittree, "strip", &m_strip, "m_strip/I");
+  addBranch(m_hittree, "adc", &m_adc, "m_adc/F");
+  addBranch(m_hittree, "zdriftlength", &m_zdriftlength, "m_zdriftlength/F");
+  addBranch(m_hittree, "mbdcharge",&m_totalmbd, "m_totalmbd/F");
 
   m_clustree = new TTree("clustertree", "A tree with all clusters");
-  m_clustree->Branch("run", &m_runnumber, "m_runnumber/I");
-  m_clustree->Branch("segment", &m_segment, "m_segment/I");
-  m_clustree->Branch("event", &m_event, "m_event/I");
-  m_clustree->Branch("gl1bco", &m_bco, "m_bco/l");
-  m_clustree->Branch("lx", &m_scluslx, "m_scluslx/F");
-  m_clustree->Branch("lz", &m_scluslz, "m_scluslz/F");
-  m_clustree->Branch("gx", &m_sclusgx, "m_sclusgx/F");
-  m_clustree->Branch("gy", &m_sclusgy, "m_sclusgy/F");
-  m_clustree->Branch("gz", &m_sclusgz, "m_sclusgz/F");
-  m_clustree->Branch("phi", &m_sclusphi, "m_sclusphi/F");
-  m_clustree->Branch("eta", &m_scluseta, "m_scluseta/F");
-  m_clustree->Branch("adc", &m_adc, "m_adc/F");
-  m_clustree->Branch("phisize", &m_phisize, "m_phisize/I");
-  m_clustree->Branch("zsize", &m_zsize, "m_zsize/I");
-  m_clustree->Branch("erphi", &m_scluselx, "m_scluselx/F");
-  m_clustree->Branch("ez", &m_scluselz, "m_scluselz/F");
-  m_clustree->Branch("maxadc", &m_clusmaxadc, "m_clusmaxadc/F");
-  m_clustree->Branch("sector", &m_clussector, "m_clussector/I");
-  m_clustree->Branch("side", &m_side, "m_side/I");
-  m_clustree->Branch("stave", &m_staveid, "m_staveid/I");
-  m_clustree->Branch("chip", &m_chipid, "m_chipid/I");
-  m_clustree->Branch("strobe", &m_strobeid, "m_strobeid/I");
-  m_clustree->Branch("ladderz", &m_ladderzid, "m_ladderzid/I");
-  m_clustree->Branch("ladderphi", &m_ladderphiid, "m_ladderphiid/I");
-  m_clustree->Branch("timebucket", &m_timebucket, "m_timebucket/I");
-  m_clustree->Branch("segtype", &m_segtype, "m_segtype/I");
-  m_clustree->Branch("tile", &m_tileid, "m_tileid/I");
-  m_clustree->Branch("layer", &m_scluslayer, "m_scluslayer/I");
+  addBranch(m_clustree, "run", &m_runnumber, "m_runnumber/I");
+  addBranch(m_clustree, "segment", &m_segment, "m_segment/I");
+  addBranch(m_clustree, "event", &m_event, "m_event/I");
+  addBranch(m_clustree, "gl1bco", &m_bco, "m_bco/l");
+  addBranch(m_clustree, "lx", &m_scluslx, "m_scluslx/F");
+  addBranch(m_clustree, "lz", &m_scluslz, "m_scluslz/F");
+  addBranch(m_clustree, "gx", &m_sclusgx, "m_sclusgx/F");
+  addBranch(m_clustree, "gy", &m_sclusgy, "m_sclusgy/F");
+  addBranch(m_clustree, "gz", &m_sclusgz, "m_sclusgz/F");
+  addBranch(m_clustree, "phi", &m_sclusphi, "m_sclusphi/F");
+  addBranch(m_clustree, "eta", &m_scluseta, "m_scluseta/F");
+  addBranch(m_clustree, "adc", &m_adc, "m_adc/F");
+  addBranch(m_clustree, "phisize", &m_phisize, "m_phisize/I");
+  addBranch(m_clustree, "zsize", &m_zsize, "m_zsize/I");
+  addBranch(m_clustree, "erphi", &m_scluselx, "m_scluselx/F");
+  addBranch(m_clustree, "ez", &m_scluselz, "m_scluselz/F");
+  addBranch(m_clustree, "maxadc", &m_clusmaxadc, "m_clusmaxadc/F");
+  addBranch(m_clustree, "sector", &m_clussector, "m_clussector/I");
+  addBranch(m_clustree, "side", &m_side, "m_side/I");
+  addBranch(m_clustree, "stave", &m_staveid, "m_staveid/I");
+  addBranch(m_clustree, "chip", &m_chipid, "m_chipid/I");
+  addBranch(m_clustree, "strobe", &m_strobeid, "m_strobeid/I");
+  addBranch(m_clustree, "ladderz", &m_ladderzid, "m_ladderzid/I");
+  addBranch(m_clustree, "ladderphi", &m_ladderphiid, "m_ladderphiid/I");
+  addBranch(m_clustree, "timebucket", &m_timebucket, "m_timebucket/I");
+  addBranch(m_clustree, "segtype", &m_segtype, "m_segtype/I");
+  addBranch(m_clustree, "tile", &m_tileid, "m_tileid/I");
+  addBranch(m_clustree, "layer", &m_scluslayer, "m_scluslayer/I");
 
   m_tree = new TTree("residualtree", "A tree with track, cluster, and state info");
-  m_tree->Branch("run", &m_runnumber, "m_runnumber/I");
-  m_tree->Branch("segment", &m_segment, "m_segment/I");
-  m_tree->Branch("event", &m_event, "m_event/I");
-  m_tree->Branch("mbdcharge",&m_totalmbd, "m_totalmbd/F");
-  m_tree->Branch("mbdzvtx", &m_mbdvtxz, "m_mbdvtxz/F");
-  m_tree->Branch("firedTriggers", &m_firedTriggers);
-  m_tree->Branch("gl1BunchCrossing", &m_gl1BunchCrossing, "m_gl1BunchCrossing/l");
-  m_tree->Branch("trackid", &m_trackid, "m_trackid/I");
-  m_tree->Branch("tpcid", &m_tpcid, "m_tpcid/I");
-  m_tree->Branch("silid", &m_silid, "m_silid/I");
-  m_tree->Branch("gl1bco", &m_bco, "m_bco/l");
-  m_tree->Branch("crossing", &m_crossing, "m_crossing/I");
-  m_tree->Branch("crossing_estimate", &m_crossing_estimate, "m_crossing_estimate/I");
-  m_tree->Branch("silseedit",&m_silseedit, "m_silseedit/I");
-  m_tree->Branch("silseedx", &m_silseedx, "m_silseedx/F");
-  m_tree->Branch("silseedy", &m_silseedy, "m_silseedy/F");
-  m_tree->Branch("silseedz", &m_silseedz, "m_silseedz/F");
-  m_tree->Branch("silseedpx", &m_silseedpx, "m_silseedpx/F");
-  m_tree->Branch("silseedpy", &m_silseedpy, "m_silseedpy/F");
-  m_tree->Branch("silseedpz", &m_silseedpz, "m_silseedpz/F");
-  m_tree->Branch("silseedphi", &m_silseedphi, "m_silseedphi/F");
-  m_tree->Branch("silseedeta", &m_silseedeta, "m_silseedeta/F");
-  m_tree->Branch("silseedcharge", &m_silseedcharge, "m_silseedcharge/I");
-  m_tree->Branch("tpcseedx", &m_tpcseedx, "m_tpcseedx/F");
-  m_tree->Branch("tpcseedy", &m_tpcseedy, "m_tpcseedy/F");
-  m_tree->Branch("tpcseedz", &m_tpcseedz, "m_tpcseedz/F");
-  m_tree->Branch("tpcseedpx", &m_tpcseedpx, "m_tpcseedpx/F");
-  m_tree->Branch("tpcseedpy", &m_tpcseedpy, "m_tpcseedpy/F");
-  m_tree->Branch("tpcseedpz", &m_tpcseedpz, "m_tpcseedpz/F");
-  m_tree->Branch("tpcseedphi", &m_tpcseedphi, "m_tpcseedphi/F");
-  m_tree->Branch("tpcseedeta", &m_tpcseedeta, "m_tpcseedeta/F");
-  m_tree->Branch("tpcseedcharge", &m_tpcseedcharge, "m_tpcseedcharge/I");
-  m_tree->Branch("dedx", &m_dedx, "m_dedx/F");
-  m_tree->Branch("tracklength", &m_tracklength, "m_tracklength/F");
-  m_tree->Branch("px", &m_px, "m_px/F");
-  m_tree->Branch("py", &m_py, "m_py/F");
-  m_tree->Branch("pz", &m_pz, "m_pz/F");
-  m_tree->Branch("pt", &m_pt, "m_pt/F");
-  m_tree->Branch("eta", &m_eta, "m_eta/F");
-  m_tree->Branch("phi", &m_phi, "m_phi/F");
-  m_tree->Branch("deltapt", &m_deltapt, "m_deltapt/F");
-  m_tree->Branch("charge", &m_charge, "m_charge/I");
-  m_tree->Branch("quality", &m_quality, "m_quality/F");
-  m_tree->Branch("ndf", &m_ndf, "m_ndf/F");
-  m_tree->Branch("nhits", &m_nhits, "m_nhits/I");
-  m_tree->Branch("nmaps", &m_nmaps, "m_nmaps/I");
-  m_tree->Branch("nmapsstate", &m_nmapsstate, "m_nmapsstate/I");
-  m_tree->Branch("nintt", &m_nintt, "m_nintt/I");
-  m_tree->Branch("ninttstate", &m_ninttstate, "m_ninttstate/I");
-  m_tree->Branch("ntpc", &m_ntpc, "m_ntpc/I");
-  m_tree->Branch("ntpcstate", &m_ntpcstate, "m_ntpcstate/I");
-  m_tree->Branch("nmms", &m_nmms, "m_nmms/I");
-  m_tree->Branch("nmmsstate", &m_nmmsstate, "m_nmmsstate/I");
-  m_tree->Branch("tile", &m_tileid, "m_tileid/I");
-  m_tree->Branch("vertexid", &m_vertexid);
-  m_tree->Branch("vertex_crossing", &m_vertex_crossing, "m_vertex_crossing/I");
-  m_tree->Branch("vx", &m_vx, "m_vx/F");
-  m_tree->Branch("vy", &m_vy, "m_vy/F");
-  m_tree->Branch("vz", &m_vz, "m_vz/F");
-  m_tree->Branch("vertex_ntracks", &m_vertex_ntracks, "m_vertex_ntracks/I");
-  m_tree->Branch("pcax", &m_pcax, "m_pcax/F");
-  m_tree->Branch("pcay", &m_pcay, "m_pcay/F");
-  m_tree->Branch("pcaz", &m_pcaz, "m_pcaz/F");
-  m_tree->Branch("rzslope", &m_rzslope, "m_rzslope/F");
-  m_tree->Branch("xyslope", &m_xyslope, "m_xyslope/F");
-  m_tree->Branch("yzslope", &m_yzslope, "m_yzslope/F");
-  m_tree->Branch("rzint", &m_rzint, "m_rzint/F");
-  m_tree->Branch("xyint", &m_xyint, "m_xyint/F");
-  m_tree->Branch("yzint", &m_yzint, "m_yzint/F");
-  m_tree->Branch("R", &m_R, "m_R/F");
-  m_tree->Branch("X0", &m_X0, "m_X0/F");
-  m_tree->Branch("Y0", &m_Y0, "m_Y0/F");
-  m_tree->Branch("dcaxy", &m_dcaxy, "m_dcaxy/F");
-  m_tree->Branch("dcaz", &m_dcaz, "m_dcaz/F");
-
-  m_tree->Branch("cluslayer", &m_cluslayer);
-  m_tree->Branch("clusstave", &m_clstave);
-  m_tree->Branch("cluschip", &m_clchip);
-  m_tree->Branch("clusladderz", &m_clladderz);
-  m_tree->Branch("clusladderphi", &m_clladderphi);
-  m_tree->Branch("clussector", &m_clsector);
-  m_tree->Branch("clusside", &m_clside);
-  m_tree->Branch("cluskeys", &m_cluskeys);
-  m_tree->Branch("clusedge", &m_clusedge);
-  m_tree->Branch("clusoverlap", &m_clusoverlap);
-  m_tree->Branch("cluslx", &m_cluslx);
-  m_tree->Branch("cluslz", &m_cluslz);
-  m_tree->Branch("cluselx", &m_cluselx);
-  m_tree->Branch("cluselz", &m_cluselz);
-  m_tree->Branch("clusgx", &m_clusgx);
-  m_tree->Branch("clusgy", &m_clusgy);
-  m_tree->Branch("clusgz", &m_clusgz);
-  m_tree->Branch("clusgr", &m_clusgr);
+  addBranch(m_tree, "run", &m_runnumber, "m_runnumber/I");
+  addBranch(m_tree, "segment", &m_segment, "m_segment/I");
+  addBranch(m_tree, "event", &m_event, "m_event/I");
+  addBranch(m_tree, "mbdcharge",&m_totalmbd, "m_totalmbd/F");
+  addBranch(m_tree, "mbdzvtx", &m_mbdvtxz, "m_mbdvtxz/F");
+  addBranch(m_tree, "firedTriggers", &m_firedTriggers);
+  addBranch(m_tree, "gl1BunchCrossing", &m_gl1BunchCrossing, "m_gl1BunchCrossing/l");
+  addBranch(m_tree, "trackid", &m_trackid, "m_trackid/I");
+  addBranch(m_tree, "tpcid", &m_tpcid, "m_tpcid/I");
+  addBranch(m_tree, "silid", &m_silid, "m_silid/I");
+  addBranch(m_tree, "gl1bco", &m_bco, "m_bco/l");
+  addBranch(m_tree, "crossing", &m_crossing, "m_crossing/I");
+  addBranch(m_tree, "crossing_estimate", &m_crossing_estimate, "m_crossing_estimate/I");
+  addBranch(m_tree, "silseedit",&m_silseedit, "m_silseedit/I");
+  addBranch(m_tree, "silseedx", &m_silseedx, "m_silseedx/F");
+  addBranch(m_tree, "silseedy", &m_silseedy, "m_silseedy/F");
+  addBranch(m_tree, "silseedz", &m_silseedz, "m_silseedz/F");
+  addBranch(m_tree, "silseedpx", &m_silseedpx, "m_silseedpx/F");
+  addBranch(m_tree, "silseedpy", &m_silseedpy, "m_silseedpy/F");
+  addBranch(m_tree, "silseedpz", &m_silseedpz, "m_silseedpz/F");
+  addBranch(m_tree, "silseedphi", &m_silseedphi, "m_silseedphi/F");
+  addBranch(m_tree, "silseedeta", &m_silseedeta, "m_silseedeta/F");
+  addBranch(m_tree, "silseedcharge", &m_silseedcharge, "m_silseedcharge/I");
+  addBranch(m_tree, "tpcseedx", &m_tpcseedx, "m_tpcseedx/F");
+  addBranch(m_tree, "tpcseedy", &m_tpcseedy, "m_tpcseedy/F");
+  addBranch(m_tree, "tpcseedz", &m_tpcseedz, "m_tpcseedz/F");
+  addBranch(m_tree, "tpcseedpx", &m_tpcseedpx, "m_tpcseedpx/F");
+  addBranch(m_tree, "tpcseedpy", &m_tpcseedpy, "m_tpcseedpy/F");
+  addBranch(m_tree, "tpcseedpz", &m_tpcseedpz, "m_tpcseedpz/F");
+  addBranch(m_tree, "tpcseedphi", &m_tpcseedphi, "m_tpcseedphi/F");
+  addBranch(m_tree, "tpcseedeta", &m_tpcseedeta, "m_tpcseedeta/F");
+  addBranch(m_tree, "tpcseedcharge", &m_tpcseedcharge, "m_tpcseedcharge/I");
+  addBranch(m_tree, "dedx", &m_dedx, "m_dedx/F");
+  addBranch(m_tree, "tracklength", &m_tracklength, "m_tracklength/F");
+  addBranch(m_tree, "px", &m_px, "m_px/F");
+  addBranch(m_tree, "py", &m_py, "m_py/F");
+  addBranch(m_tree, "pz", &m_pz, "m_pz/F");
+  addBranch(m_tree, "pt", &m_pt, "m_pt/F");
+  addBranch(m_tree, "eta", &m_eta, "m_eta/F");
+  addBranch(m_tree, "phi", &m_phi, "m_phi/F");
+  addBranch(m_tree, "deltapt", &m_deltapt, "m_deltapt/F");
+  addBranch(m_tree, "charge", &m_charge, "m_charge/I");
+  addBranch(m_tree, "quality", &m_quality, "m_quality/F");
+  addBranch(m_tree, "ndf", &m_ndf, "m_ndf/F");
+  addBranch(m_tree, "nhits", &m_nhits, "m_nhits/I");
+  addBranch(m_tree, "nmaps", &m_nmaps, "m_nmaps/I");
+  addBranch(m_tree, "nmapsstate", &m_nmapsstate, "m_nmapsstate/I");
+  addBranch(m_tree, "nintt", &m_nintt, "m_nintt/I");
+  addBranch(m_tree, "ninttstate", &m_ninttstate, "m_ninttstate/I");
+  addBranch(m_tree, "ntpc", &m_ntpc, "m_ntpc/I");
+  addBranch(m_tree, "ntpcstate", &m_ntpcstate, "m_ntpcstate/I");
+  addBranch(m_tree, "nmms", &m_nmms, "m_nmms/I");
+  addBranch(m_tree, "nmmsstate", &m_nmmsstate, "m_nmmsstate/I");
+  addBranch(m_tree, "tile", &m_tileid, "m_tileid/I");
+  addBranch(m_tree, "vertexid", &m_vertexid);
+  addBranch(m_tree, "vertex_crossing", &m_vertex_crossing, "m_vertex_crossing/I");
+  addBranch(m_tree, "vx", &m_vx, "m_vx/F");
+  addBranch(m_tree, "vy", &m_vy, "m_vy/F");
+  addBranch(m_tree, "vz", &m_vz, "m_vz/F");
+  addBranch(m_tree, "vertex_ntracks", &m_vertex_ntracks, "m_vertex_ntracks/I");
+  addBranch(m_tree, "pcax", &m_pcax, "m_pcax/F");
+  addBranch(m_tree, "pcay", &m_pcay, "m_pcay/F");
+  addBranch(m_tree, "pcaz", &m_pcaz, "m_pcaz/F");
+  addBranch(m_tree, "rzslope", &m_rzslope, "m_rzslope/F");
+  addBranch(m_tree, "xyslope", &m_xyslope, "m_xyslope/F");
+  addBranch(m_tree, "yzslope", &m_yzslope, "m_yzslope/F");
+  addBranch(m_tree, "rzint", &m_rzint, "m_rzint/F");
+  addBranch(m_tree, "xyint", &m_xyint, "m_xyint/F");
+  addBranch(m_tree, "yzint", &m_yzint, "m_yzint/F");
+  addBranch(m_tree, "R", &m_R, "m_R/F");
+  addBranch(m_tree, "X0", &m_X0, "m_X0/F");
+  addBranch(m_tree, "Y0", &m_Y0, "m_Y0/F");
+  addBranch(m_tree, "dcaxy", &m_dcaxy, "m_dcaxy/F");
+  addBranch(m_tree, "dcaz", &m_dcaz, "m_dcaz/F");
+
+  addBranch(m_tree, "cluslayer", &m_cluslayer);
+  addBranch(m_tree, "clusstave", &m_clstave);
+  addBranch(m_tree, "cluschip", &m_clchip);
+  addBranch(m_tree, "clusladderz", &m_clladderz);
+  addBranch(m_tree, "clusladderphi", &m_clladderphi);
+  addBranch(m_tree, "clussector", &m_clsector);
+  addBranch(m_tree, "clusside", &m_clside);
+  addBranch(m_tree, "cluskeys", &m_cluskeys);
+  addBranch(m_tree, "clusedge", &m_clusedge);
+  addBranch(m_tree, "clusoverlap", &m_clusoverlap);
+  addBranch(m_tree, "cluslx", &m_cluslx);
+  addBranch(m_tree, "cluslz", &m_cluslz);
+  addBranch(m_tree, "cluselx", &m_cluselx);
+  addBranch(m_tree, "cluselz", &m_cluselz);
+  addBranch(m_tree, "clusgx", &m_clusgx);
+  addBranch(m_tree, "clusgy", &m_clusgy);
+  addBranch(m_tree, "clusgz", &m_clusgz);
+  addBranch(m_tree, "clusgr", &m_clusgr);
   if (m_doAlignment)
   {
-    m_tree->Branch("clusgxunmoved", &m_clusgxunmoved);
-    m_tree->Branch("clusgyunmoved", &m_clusgyunmoved);
-    m_tree->Branch("clusgzunmoved", &m_clusgzunmoved);
+    addBranch(m_tree, "clusgxunmoved", &m_clusgxunmoved);
+    addBranch(m_tree, "clusgyunmoved", &m_clusgyunmoved);
+    addBranch(m_tree, "clusgzunmoved", &m_clusgzunmoved);
   }
-  m_tree->Branch("clusAdc", &m_clusAdc);
-  m_tree->Branch("clusMaxAdc", &m_clusMaxAdc);
-  m_tree->Branch("clusphisize", &m_clusphisize);
-  m_tree->Branch("cluszsize", &m_cluszsize);
+  addBranch(m_tree, "clusAdc", &m_clusAdc);
+  addBranch(m_tree, "clusMaxAdc", &m_clusMaxAdc);
+  addBranch(m_tree, "clusphisize", &m_clusphisize);
+  addBranch(m_tree, "cluszsize", &m_cluszsize);
 
   if (m_doAlignment)
   {
-    m_tree->Branch("idealsurfcenterx", &m_idealsurfcenterx);
-    m_tree->Branch("idealsurfcentery", &m_idealsurfcentery);
-    m_tree->Branch("idealsurfcenterz", &m_idealsurfcenterz);
-    m_tree->Branch("idealsurfnormx", &m_idealsurfnormx);
-    m_tree->Branch("idealsurfnormy", &m_idealsurfnormy);
-    m_tree->Branch("idealsurfnormz", &m_idealsurfnormz);
-    m_tree->Branch("missurfcenterx", &m_missurfcenterx);
-    m_tree->Branch("missurfcentery", &m_missurfcentery);
-    m_tree->Branch("missurfcenterz", &m_missurfcenterz);
-    m_tree->Branch("missurfnormx", &m_missurfnormx);
-    m_tree->Branch("missurfnormy", &m_missurfnormy);
-    m_tree->Branch("missurfnormz", &m_missurfnormz);
-    m_tree->Branch("clusgxideal", &m_clusgxideal);
-    m_tree->Branch("clusgyideal", &m_clusgyideal);
-    m_tree->Branch("clusgzideal", &m_clusgzideal);
-    m_tree->Branch("missurfalpha", &m_missurfalpha);
-    m_tree->Branch("missurfbeta", &m_missurfbeta);
-    m_tree->Branch("missurfgamma", &m_missurfgamma);
-    m_tree->Branch("idealsurfalpha", &m_idealsurfalpha);
-    m_tree->Branch("idealsurfbeta", &m_idealsurfbeta);
-    m_tree->Branch("idealsurfgamma", &m_idealsurfgamma);
-  }
-
-  m_tree->Branch("statelx", &m_statelx);
-  m_tree->Branch("statelz", &m_statelz);
-  m_tree->Branch("stateelx", &m_stateelx);
-  m_tree->Branch("stateelz", &m_stateelz);
-  m_tree->Branch("stategx", &m_stategx);
-  m_tree->Branch("stategy", &m_stategy);
-  m_tree->Branch("stategz", &m_stategz);
-  m_tree->Branch("statepx", &m_statepx);
-  m_tree->Branch("statepy", &m_statepy);
-  m_tree->Branch("statepz", &m_statepz);
-  m_tree->Branch("statepl", &m_statepl);
+    addBranch(m_tree, "idealsurfcenterx", &m_idealsurfcenterx);
+    addBranch(m_tree, "idealsurfcentery", &m_idealsurfcentery);
+    addBranch(m_tree, "idealsurfcenterz", &m_idealsurfcenterz);
+    addBranch(m_tree, "idealsurfnormx", &m_idealsurfnormx);
+    addBranch(m_tree, "idealsurfnormy", &m_idealsurfnormy);
+    addBranch(m_tree, "idealsurfnormz", &m_idealsurfnormz);
+    addBranch(m_tree, "missurfcenterx", &m_missurfcenterx);
+    addBranch(m_tree, "missurfcentery", &m_missurfcentery);
+    addBranch(m_tree, "missurfcenterz", &m_missurfcenterz);
+    addBranch(m_tree, "missurfnormx", &m_missurfnormx);
+    addBranch(m_tree, "missurfnormy", &m_missurfnormy);
+    addBranch(m_tree, "missurfnormz", &m_missurfnormz);
+    addBranch(m_tree, "clusgxideal", &m_clusgxideal);
+    addBranch(m_tree, "clusgyideal", &m_clusgyideal);
+    addBranch(m_tree, "clusgzideal", &m_clusgzideal);
+    addBranch(m_tree, "missurfalpha", &m_missurfalpha);
+    addBranch(m_tree, "missurfbeta", &m_missurfbeta);
+    addBranch(m_tree, "missurfgamma", &m_missurfgamma);
+    addBranch(m_tree, "idealsurfalpha", &m_idealsurfalpha);
+    addBranch(m_tree, "idealsurfbeta", &m_idealsurfbeta);
+    addBranch(m_tree, "idealsurfgamma", &m_idealsurfgamma);
+  }
+
+  addBranch(m_tree, "statelx", &m_statelx);
+  addBranch(m_tree, "statelz", &m_statelz);
+  addBranch(m_tree, "stateelx", &m_stateelx);
+  addBranch(m_tree, "stateelz", &m_stateelz);
+  addBranch(m_tree, "stategx", &m_stategx);
+  addBranch(m_tree, "stategy", &m_stategy);
+  addBranch(m_tree, "stategz", &m_stategz);
+  addBranch(m_tree, "statepx", &m_statepx);
+  addBranch(m_tree, "statepy", &m_statepy);
+  addBranch(m_tree, "statepz", &m_statepz);
+  addBranch(m_tree, "statepl", &m_statepl);
 
   if (m_doAlignment)
   {
-    m_tree->Branch("statelxglobderivdx", &m_statelxglobderivdx);
-    m_tree->Branch("statelxglobderivdy", &m_statelxglobderivdy);
-    m_tree->Branch("statelxglobderivdz", &m_statelxglobderivdz);
-    m_tree->Branch("statelxglobderivdalpha", &m_statelxglobderivdalpha);
-    m_tree->Branch("statelxglobderivdbeta", &m_statelxglobderivdbeta);
-    m_tree->Branch("statelxglobderivdgamma", &m_statelxglobderivdgamma);
-
-    m_tree->Branch("statelxlocderivd0", &m_statelxlocderivd0);
-    m_tree->Branch("statelxlocderivz0", &m_statelxlocderivz0);
-    m_tree->Branch("statelxlocderivphi", &m_statelxlocderivphi);
-    m_tree->Branch("statelxlocderivtheta", &m_statelxlocderivtheta);
-    m_tree->Branch("statelxlocderivqop", &m_statelxlocderivqop);
-
-    m_tree->Branch("statelzglobderivdx", &m_statelzglobderivdx);
-    m_tree->Branch("statelzglobderivdy", &m_statelzglobderivdy);
-    m_tree->Branch("statelzglobderivdz", &m_statelzglobderivdz);
-    m_tree->Branch("statelzglobderivdalpha", &m_statelzglobderivdalpha);
-    m_tree->Branch("statelzglobderivdbeta", &m_statelzglobderivdbeta);
-    m_tree->Branch("statelzglobderivdgamma", &m_statelzglobderivdgamma);
-
-    m_tree->Branch("statelzlocderivd0", &m_statelzlocderivd0);
-    m_tree->Branch("statelzlocderivz0", &m_statelzlocderivz0);
-    m_tree->Branch("statelzlocderivphi", &m_statelzlocderivphi);
-    m_tree->Branch("statelzlocderivtheta", &m_statelzlocderivtheta);
-    m_tree->Branch("statelzlocderivqop", &m_statelzlocderivqop);
+    addBranch(m_tree, "statelxglobderivdx", &m_statelxglobderivdx);
+    addBranch(m_tree, "statelxglobderivdy", &m_statelxglobderivdy);
+    addBranch(m_tree, "statelxglobderivdz", &m_statelxglobderivdz);
+    addBranch(m_tree, "statelxglobderivdalpha", &m_statelxglobderivdalpha);
+    addBranch(m_tree, "statelxglobderivdbeta", &m_statelxglobderivdbeta);
+    addBranch(m_tree, "statelxglobderivdgamma", &m_statelxglobderivdgamma);
+
+    addBranch(m_tree, "statelxlocderivd0", &m_statelxlocderivd0);
+    addBranch(m_tree, "statelxlocderivz0", &m_statelxlocderivz0);
+    addBranch(m_tree, "statelxlocderivphi", &m_statelxlocderivphi);
+    addBranch(m_tree, "statelxlocderivtheta", &m_statelxlocderivtheta);
+    addBranch(m_tree, "statelxlocderivqop", &m_statelxlocderivqop);
+
+    addBranch(m_tree, "statelzglobderivdx", &m_statelzglobderivdx);
+    addBranch(m_tree, "statelzglobderivdy", &m_statelzglobderivdy);
+    addBranch(m_tree, "statelzglobderivdz", &m_statelzglobderivdz);
+    addBranch(m_tree, "statelzglobderivdalpha", &m_statelzglobderivdalpha);
+    addBranch(m_tree, "statelzglobderivdbeta", &m_statelzglobderivdbeta);
+    addBranch(m_tree, "statelzglobderivdgamma", &m_statelzglobderivdgamma);
+
+    addBranch(m_tree, "statelzlocderivd0", &m_statelzlocderivd0);
+    addBranch(m_tree, "statelzlocderivz0", &m_statelzlocderivz0);
+    addBranch(m_tree, "statelzlocderivphi", &m_statelzlocderivphi);
+    addBranch(m_tree, "statelzlocderivtheta", &m_statelzlocderivtheta);
+    addBranch(m_tree, "statelzlocderivqop", &m_statelzlocderivqop);
   }
 }
 
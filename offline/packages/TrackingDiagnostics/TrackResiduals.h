@@ -18,6 +18,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <set>
 #include <string>
 
 class TrkrCluster;
@@ -65,11 +66,36 @@ class TrackResiduals : public SubsysReco
 
   void set_use_clustermover(bool flag) { m_use_clustermover = flag; }
 
+  //! colon separated list of branches which are not created, in all trees
+  void dropBranches(const std::string &branches);
+  //! ROOT compression setting of the output file
+  void compressionSetting(const int setting) { m_compressionSetting = setting; }
+  //! compress baskets in parallel with nthreads ROOT implicit MT threads,
+  //! this calls ROOT::EnableImplicitMT which is process wide
+  void compressionThreads(const int nthreads) { m_compressionThreads = nthreads; }
+
  private:
   void fillStatesWithLineFit(const TrkrDefs::cluskey &ckey,
                              TrkrCluster *cluster, ActsGeometry *geometry);
   void clearClusterStateVectors();
   void createBranches();
+  //! create the branch unless it is dropped
+  template <typename T>
+  void addBranch(TTree *tree, const std::string &name, T *address, const std::string &leaflist = "")
+  {
+    if (m_droppedBranches.contains(name))
+    {
+      return;
+    }
+    if (leaflist.empty())
+    {
+      tree->Branch(name.c_str(), address);
+    }
+    else
+    {
+      tree->Branch(name.c_str(), address, leaflist.c_str());
+    }
+  }
   static float convertTimeToZ(ActsGeometry *geometry, TrkrDefs::cluskey cluster_key, TrkrCluster *cluster);
   void fillEventTree(PHCompositeNode *topNode);
   void fillClusterTree(TrkrClusterContainer *clusters, ActsGeometry *geometry);
@@ -92,6 +118,9 @@ class TrackResiduals : public SubsysReco
   void fillFailedSeedTree(PHCompositeNode *topNode, std::set<unsigned int> &tpc_seed_ids);
 
   bool m_use_clustermover = true;
+  std::set<std::string> m_droppedBranches;
+  int m_compressionSetting = -1;
+  int m_compressionThreads = 0;
 
   std::string m_outfileName = "";
   TFile *m_outfile = nullptr;
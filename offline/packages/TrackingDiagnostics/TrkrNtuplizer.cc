@@ -1,5 +1,7 @@
 #include "TrkrNtuplizer.h"
 
+#include "DiagnosticNtuple.h"
+
 #include <trackbase/ActsGeometry.h>
 #include <trackbase/ClusterErrorPara.h>
 #include <trackbase/InttDefs.h>
@@ -64,7 +66,7 @@
 #include <phool/recoConsts.h>
 
 #include <TFile.h>
-#include <TNtuple.h>
+#include <TROOT.h>
 #include <TVector3.h>
 
 #include <cmath>
@@ -327,12 +329,30 @@ TrkrNtuplizer::~TrkrNtuplizer()
   delete _timer;
 }
 
+void TrkrNtuplizer::drop_columns(const std::string& columns)
+{
+  const auto dropped = DiagnosticNtuple::split(columns);
+  m_dropped_columns.insert(dropped.begin(), dropped.end());
+}
+
 int TrkrNtuplizer::Init(PHCompositeNode* /*unused*/)
 {
   _ievent = 0;
 
+  // implicit MT has to be on before the ntuples are created
+  if (m_compression_threads > 0 && !ROOT::IsImplicitMTEnabled())
+  {
+    ROOT::EnableImplicitMT(m_compression_threads);
+  }
   _tfile = new TFile(_filename.c_str(), "RECREATE");
-  _tfile->SetCompressionLevel(7);
+  if (m_compression_setting >= 0)
+  {
+    _tfile->SetCompressionSettings(m_compression_setting);
+  }
+  else
+  {
+    _tfile->SetCompressionLevel(7);
+  }
 
   std::string str_vertex = {"vertexID:vx:vy:vz:ntracks:chi2:ndof"};
   std::string str_event = {"event:seed:run:seg:job"};
@@ -345,47 +365,47 @@ int TrkrNtuplizer::Init(PHCompositeNode* /*unused*/)
   if (_do_info_eval)
   {
     std::string ntp_varlist_info = str_event + ":" + str_info;
-    _ntp_info = new TNtuple("ntp_info", "event info", ntp_varlist_info.c_str());
+    _ntp_info = new DiagnosticNtuple("ntp_info", "event info", ntp_varlist_info, m_dropped_columns);
   }
 
   if (_do_vertex_eval)
   {
     std::string ntp_varlist_vtx = str_event + ":" + str_vertex + ":" + str_info;
-    _ntp_vertex = new TNtuple("ntp_vertex", "vertex => max truth", ntp_varlist_vtx.c_str());
+    _ntp_vertex = new DiagnosticNtuple("ntp_vertex", "vertex => max truth", ntp_varlist_vtx, m_dropped_columns);
   }
 
   if (_do_hit_eval)
   {
     std::string ntp_varlist_ev = str_event + ":" + str_hit + ":" + str_info;
-    _ntp_hit = new TNtuple("ntp_hit", "svtxhit => max truth", ntp_varlist_ev.c_str());
+    _ntp_hit = new DiagnosticNtuple("ntp_hit", "svtxhit => max truth", ntp_varlist_ev, m_dropped_columns);
   }
 
   if (_do_cluster_eval)
   {
     std::string ntp_varlist_clu = str_event + ":" + str_cluster + ":" + str_info;
-    _ntp_cluster = new TNtuple("ntp_cluster", "svtxcluster => max truth", ntp_varlist_clu.c_str());
+    _ntp_cluster = new DiagnosticNtuple("ntp_cluster", "svtxcluster => max truth", ntp_varlist_clu, m_dropped_columns);
   }
   if (_do_clus_trk_eval)
   {
     std::string ntp_varlist_clut = str_event + ":" + str_cluster + ":" + str_residual + ":" + str_seed + ":" + str_info;
-    _ntp_clus_trk = new TNtuple("ntp_clus_trk", "cluster on track", ntp_varlist_clut.c_str());
+    _ntp_clus_trk = new DiagnosticNtuple("ntp_clus_trk", "cluster on track", ntp_varlist_clut, m_dropped_columns);
   }
 
   if (_do_track_eval)
   {
     std::string ntp_varlist_trk = str_event + ":" + str_track + ":" + str_info;
-    _ntp_track = new TNtuple("ntp_track", "svtxtrack => max truth", ntp_varlist_trk.c_str());
+    _ntp_track = new DiagnosticNtuple("ntp_track", "svtxtrack => max truth", ntp_varlist_trk, m_dropped_columns);
   }
 
   if (_do_tpcseed_eval)
   {
     std::string ntp_varlist_tsee = str_event + ":" + str_seed + ":" + str_info;
-    _ntp_tpcseed = new TNtuple("ntp_tpcseed", "seeds from truth", ntp_varlist_tsee.c_str());
+    _ntp_tpcseed = new DiagnosticNtuple("ntp_tpcseed", "seeds from truth", ntp_varlist_tsee, m_dropped_columns);
   }
   if (_do_siseed_eval)
   {
     std::string ntp_varlist_ssee = str_event + ":" + str_seed + ":" + str_info;
-    _ntp_siseed = new TNtuple("ntp_siseed", "seeds from truth", ntp_varlist_ssee.c_str());
+    _ntp_siseed = new DiagnosticNtuple("ntp_siseed", "seeds from truth", ntp_varlist_ssee, m_dropped_columns);
   }
 
   std::string dedx_fitparams = CDBInterface::instance()->getUrl("TPC_DEDX_FITPARAM");
@@ -910,6 +930,12 @@ int TrkrNtuplizer::End(PHCompositeNode* /*topNode*/)
   _tfile->Close();
 
   delete _tfile;
+  // the ntuples themselves belonged to the file
+  for (DiagnosticNtuple** ntp : {&_ntp_info, &_ntp_vertex, &_ntp_hit, &_ntp_cluster, &_ntp_clus_trk, &_ntp_track, &_ntp_tpcseed, &_ntp_siseed})
+  {
+    delete *ntp;
+    *ntp = nullptr;
+  }
 
   if (Verbosity() > 1)
   {
@@ -1378,11 +1404,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
       std::cout << "EVENTINFO NTRKREC: " << fx_info[n_info::infontrk] << std::endl;
     }
 
-    float* info_data = new float[((int) (n_info::infosize)) + n_event::evsize];
-    std::copy(fx_event, fx_event + n_event::evsize, info_data);
-    std::copy(fx_info, fx_info + ((int) (n_info::infosize)), info_data + n_event::evsize);
-    _ntp_info->Fill(info_data);
-    delete[] info_data;
+    _ntp_info->Fill({fx_event, fx_info});
   }
 
   //-----------------------
@@ -1419,12 +1441,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
     {
       std::cout << " adding vertex data " << std::endl;
     }
-    float* vertex_data = new float[((int) (n_info::infosize)) + n_event::evsize + n_vertex::vtxsize];
-    std::copy(fx_event, fx_event + n_event::evsize, vertex_data);
-    std::copy(fx_vertex, fx_vertex + n_vertex::vtxsize, vertex_data + n_event::evsize);
-    std::copy(fx_info, fx_info + ((int) (n_info::infosize)), vertex_data + n_event::evsize + n_vertex::vtxsize);
-    _ntp_vertex->Fill(vertex_data);
-    delete[] vertex_data;
+    _ntp_vertex->Fill({fx_event, fx_vertex, fx_info});
   }
   if (Verbosity() > 1)
   {
@@ -1437,8 +1454,6 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
 
   if (_ntp_hit)
   {
-    float* hit_data = new float[((int) (n_info::infosize)) + n_event::evsize + n_hit::hitsize];
-    float fx_hit_0[((int) (n_info::infosize)) + n_event::evsize + n_hit::hitsize] = {0};
     float fx_hit[((int) (n_hit::hitsize))] = {0};
     auto* m_tGeometry = findNode::getClass<ActsGeometry>(topNode, "ActsGeometry");
 
@@ -1579,15 +1594,9 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
             fx_hit[n_hit::nhity] = glob.y();
           }
 
-          std::copy(fx_event, fx_event + n_event::evsize, hit_data);
-          std::copy(fx_hit, fx_hit + n_hit::hitsize, hit_data + n_event::evsize);
-          std::copy(fx_info, fx_info + ((int) (n_info::infosize)), hit_data + n_event::evsize + n_hit::hitsize);
-          _ntp_hit->Fill(hit_data);
-          // erase hit data
-          std::copy(fx_hit_0, fx_hit_0 + ((int) (n_info::infosize)) + n_event::evsize + n_hit::hitsize, hit_data);
+          _ntp_hit->Fill({fx_event, fx_hit, fx_info});
         }
       }
-      delete[] hit_data;
     }
     if (Verbosity() >= 1)
     {
@@ -1640,8 +1649,6 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
 
     if (_cluster_map && hitsets)
     {
-      float* cluster_data = new float[((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize];
-      Float_t fx_cluster_0[((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize] = {0};
       for (const auto& hitsetkey : _cluster_map->getHitSetKeys())
       {
         auto range = _cluster_map->getClusters(hitsetkey);
@@ -1651,14 +1658,9 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
           Float_t fx_cluster[n_cluster::clusize];
           FillCluster(&fx_cluster[0], cluster_key);
 
-          std::copy(fx_event, fx_event + n_event::evsize, cluster_data);
-          std::copy(fx_cluster, fx_cluster + n_cluster::clusize, cluster_data + n_event::evsize);
-          std::copy(fx_info, fx_info + ((int) (n_info::infosize)), cluster_data + n_event::evsize + n_cluster::clusize);
-          _ntp_cluster->Fill(cluster_data);
-          std::copy(fx_cluster_0, fx_cluster_0 + ((int) (n_info::infosize)) + n_event::evsize + n_cluster::clusize, cluster_data);
+          _ntp_cluster->Fill({fx_event, fx_cluster, fx_info});
         }
       }
-      delete[] cluster_data;
     }
   }
 
@@ -1693,8 +1695,6 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
     if (_trackmap)
     {
       int trackID = 0;
-      float* clus_trk_data = new float[((int) (n_info::infosize)) + n_cluster::clusize + n_residual::ressize + n_seed::seedsize + n_event::evsize];
-      float fx_clus_trk_0[((int) (n_info::infosize)) + n_cluster::clusize + n_residual::ressize + n_seed::seedsize + n_event::evsize] = {0};
       for (auto& iter : *_trackmap)
       {
         trackID++;
@@ -1810,12 +1810,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
         float fx_seed[n_seed::seedsize] = {(float) trackID, 0, tpt, tptot, teta, tphi, xyint, rzint, xyslope, rzslope, tX0, tY0, tZ0, R0, charge, dedx, pidedx, kdedx, prdedx, n1pix, nsil_local, ntpc_local, nhits_local};
         if (_ntp_tpcseed)
         {
-          float* tpcseed_data = new float[((int) (n_info::infosize)) + n_cluster::clusize + n_residual::ressize + n_seed::seedsize + n_event::evsize];
-          std::copy(fx_event, fx_event + n_event::evsize, tpcseed_data);
-          std::copy(fx_seed, fx_seed + n_seed::seedsize, tpcseed_data + n_event::evsize);
-          std::copy(fx_info, fx_info + ((int) (n_info::infosize)), tpcseed_data + n_event::evsize + n_seed::seedsize);
-          _ntp_tpcseed->Fill(tpcseed_data);
-          delete[] tpcseed_data;
+          _ntp_tpcseed->Fill({fx_event, fx_seed, fx_info});
         }
 
         for (unsigned int i = 0; i < clusterPositions.size(); i++)
@@ -1871,16 +1866,9 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
           float fx_res[n_residual::ressize] = {alpha, beta, dphi, dphi, dz};
           // sphi:syxint:srzint:sxyslope:srzslope:sX0:sY0:sdZ0:sR0
           FillCluster(&fx_cluster[0], cluster_key);
-          std::copy(fx_event, fx_event + n_event::evsize, clus_trk_data);
-          std::copy(fx_cluster, fx_cluster + n_cluster::clusize, clus_trk_data + n_event::evsize);
-          std::copy(fx_res, fx_res + n_residual::ressize, clus_trk_data + n_event::evsize + n_cluster::clusize);
-          std::copy(fx_seed, fx_seed + n_seed::seedsize, clus_trk_data + n_event::evsize + n_cluster::clusize + n_residual::ressize);
-          std::copy(fx_info, fx_info + ((int) (n_info::infosize)), clus_trk_data + n_event::evsize + n_cluster::clusize + n_residual::ressize + n_seed::seedsize);
-          _ntp_clus_trk->Fill(clus_trk_data);
-          std::copy(fx_clus_trk_0, fx_clus_trk_0 + ((int) (n_info::infosize)) + n_cluster::clusize + n_residual::ressize + n_seed::seedsize + n_event::evsize, clus_trk_data);
+          _ntp_clus_trk->Fill({fx_event, fx_cluster, fx_res, fx_seed, fx_info});
         }
       }
-      delete[] clus_trk_data;
     }
   }
 
@@ -1903,12 +1891,7 @@ void TrkrNtuplizer::fillOutputNtuples(PHCompositeNode* topNode)
         SvtxTrack* track = iter.second;
         float fx_track[n_track::trksize];
         FillTrack(&fx_track[0], track, vertexmap);
-        float* track_data = new float[((int) (n_info::infosize)) + n_track::trksize + n_event::evsize];
-        std::copy(fx_event, fx_event + n_event::evsize, track_data);
-        std::copy(fx_track, fx_track + n_track::trksize, track_data + n_event::evsize);
-        std::copy(fx_info, fx_info + ((int) (n_info::infosize)), track_data + n_event::evsize + n_track::trksize);
-        _ntp_track->Fill(track_data);
-        delete[] track_data;
+        _ntp_track->Fill({fx_event, fx_track, fx_info});
       }
     }
     if (Verbosity() > 1)
@@ -27,7 +27,7 @@ class PHCompositeNode;
 class PHTimer;
 class TrkrCluster;
 class TFile;
-class TNtuple;
+class DiagnosticNtuple;
 class SvtxTrack;
 class TrackSeed;
 class SvtxTrackMap;
@@ -88,6 +88,14 @@ class TrkrNtuplizer : public SubsysReco
   void segment(const int seg) { m_segment = seg; }
   void runnumber(const int run) { m_runnumber = run; }
   void job(const int job) { m_job = job; }
+  //! colon separated list of columns which are not written to any ntuple,
+  //! e.g. the info columns which are repeated in every row
+  void drop_columns(const std::string &columns);
+  //! ROOT compression setting of the output file (default: level 7 of the default algorithm)
+  void set_compression_setting(const int setting) { m_compression_setting = setting; }
+  //! compress baskets in parallel with nthreads ROOT implicit MT threads,
+  //! this calls ROOT::EnableImplicitMT which is process wide
+  void set_compression_threads(const int nthreads) { m_compression_threads = nthreads; }
 
  private:
   struct fee_info
@@ -135,19 +143,23 @@ class TrkrNtuplizer : public SubsysReco
   bool _do_tpcseed_eval{false};
   bool _do_siseed_eval{false};
 
+  std::set<std::string> m_dropped_columns;
+  int m_compression_setting{-1};
+  int m_compression_threads{0};
+
   unsigned int _nlayers_maps{3};
   unsigned int _nlayers_intt{4};
   unsigned int _nlayers_tpc{48};
   unsigned int _nlayers_mms{2};
 
-  TNtuple *_ntp_info{nullptr};
-  TNtuple *_ntp_vertex{nullptr};
-  TNtuple *_ntp_hit{nullptr};
-  TNtuple *_ntp_cluster{nullptr};
-  TNtuple *_ntp_clus_trk{nullptr};
-  TNtuple *_ntp_track{nullptr};
-  TNtuple *_ntp_tpcseed{nullptr};
-  TNtuple *_ntp_siseed{nullptr};
+  DiagnosticNtuple *_ntp_info{nullptr};
+  DiagnosticNtuple *_ntp_vertex{nullptr};
+  DiagnosticNtuple *_ntp_hit{nullptr};
+  DiagnosticNtuple *_ntp_cluster{nullptr};
+  DiagnosticNtuple *_ntp_clus_trk{nullptr};
+  DiagnosticNtuple *_ntp_track{nullptr};
+  DiagnosticNtuple *_ntp_tpcseed{nullptr};
+  DiagnosticNtuple *_ntp_siseed{nullptr};
 
   // evaluator output file
   std::string _filename;
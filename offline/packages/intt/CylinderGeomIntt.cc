@@ -154,3 +154,43 @@ void CylinderGeomIntt::find_strip_center_localcoords(const int segment_z_bin, co
   location[1] = ypos;
   location[2] = zpos;
 }
+
+const std::vector<double>& CylinderGeomIntt::get_strip_y_centers()
+{
+  if (m_StripYCenters.empty())
+  {
+    build_strip_tables();
+  }
+  return m_StripYCenters;
+}
+
+const std::vector<double>& CylinderGeomIntt::get_strip_z_centers(const int itype)
+{
+  if (m_StripYCenters.empty())
+  {
+    build_strip_tables();
+  }
+  return (itype == 1) ? m_StripZCenters[1] : m_StripZCenters[0];
+}
+
+void CylinderGeomIntt::build_strip_tables()
+{
+  // filled from find_strip_center_localcoords to get bitwise the same values,
+  // segment_z_bin 0 is a type-A, 1 a type-B sensor
+  double location[3];
+  m_StripYCenters.resize(std::max(m_NStripsPhiCell, 0));
+  for (int iy = 0; iy < (int) m_StripYCenters.size(); ++iy)
+  {
+    find_strip_center_localcoords(0, iy, 0, location);
+    m_StripYCenters[iy] = location[1];
+  }
+  for (int itype = 0; itype < 2; ++itype)
+  {
+    m_StripZCenters[itype].resize(std::max(m_NStripsZSensor[itype], 0));
+    for (int iz = 0; iz < (int) m_StripZCenters[itype].size(); ++iz)
+    {
+      find_strip_center_localcoords(itype, 0, iz, location);
+      m_StripZCenters[itype][iz] = location[2];
+    }
+  }
+}
@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 class CylinderGeomInttHelper;
 
@@ -105,6 +106,31 @@ class CylinderGeomIntt : public PHG4CylinderGeom
   void find_indices_from_world_location(int& segment_z_bin, int& segment_phi_bin, double location[]);
   void find_strip_center_localcoords (const int segment_z_bin, const int strip_y_index, const int strip_z_index, double* location);
 
+  //! local y of the strip centers and local z for sensor type itype,
+  //! same values as find_strip_center_localcoords. Built on first use, not streamed
+  const std::vector<double>& get_strip_y_centers();
+  const std::vector<double>& get_strip_z_centers(const int itype);
+
+  //! strip center in local coordinates from the cached tables
+  void get_strip_center_localcoords(const int segment_z_bin, const int strip_y_index, const int strip_z_index, double* location)
+  {
+    if (m_StripYCenters.empty())
+    {
+      build_strip_tables();
+    }
+    const int itype = segment_z_bin % 2;
+    if (itype < 0 || strip_y_index < 0 || strip_y_index >= (int) m_StripYCenters.size() ||
+        strip_z_index < 0 || strip_z_index >= (int) m_StripZCenters[itype].size())
+    {
+      // NOLINTNEXTLINE(readability-suspicious-call-argument)
+      find_strip_center_localcoords(segment_z_bin, strip_y_index, strip_z_index, location);
+      return;
+    }
+    location[0] = 0.0;
+    location[1] = m_StripYCenters[strip_y_index];
+    location[2] = m_StripZCenters[itype][strip_z_index];
+  }
+
   void find_strip_center(int, int, int, int, double*) override
   {
     std::cout << "find_strip_center(int, int, int, int, double[]) is deprecated" << std::endl;
@@ -136,6 +162,13 @@ class CylinderGeomIntt : public PHG4CylinderGeom
   double m_StripZ[2]{std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()};
   double m_LadderZ[2]{std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN()};
 
+ private:
+  void build_strip_tables();
+
+  //! strip center tables, the local positions do not depend on the alignment
+  std::vector<double> m_StripYCenters;     //!
+  std::vector<double> m_StripZCenters[2];  //!
+
   ClassDefOverride(CylinderGeomIntt, 1)
 };
 
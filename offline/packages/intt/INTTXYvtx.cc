@@ -10,6 +10,7 @@
 #include <TLegend.h>
 #include <TProfile.h>
 
+#include <algorithm>
 #include <cmath>
 #include <filesystem>
 #include <format>
@@ -417,19 +418,40 @@ void INTTXYvtx::ProcessEvt(
 
   //-------------------------------
   // tracklet reconstruction accumulated multiple events
+  // note : the outer clusters are sorted in phi, so that each inner cluster only scans the outer clusters in its phi window.
+  // note : the pairs are then stored in the original outer cluster order
+  const double pre_phi_cut = 7;  // todo : the pre phi cut is here, can be optimized
+  outer_phi_order.resize(temp_sPH_outer_nocolumn_vec.size());
+  std::iota(outer_phi_order.begin(), outer_phi_order.end(), 0);
+  std::stable_sort(outer_phi_order.begin(), outer_phi_order.end(), [&temp_sPH_outer_nocolumn_vec](unsigned int lhs, unsigned int rhs)
+                   { return temp_sPH_outer_nocolumn_vec[lhs].phi < temp_sPH_outer_nocolumn_vec[rhs].phi; });
+
   for (const auto& inner_i : temp_sPH_inner_nocolumn_vec)
   {
-    for (const auto& outer_i : temp_sPH_outer_nocolumn_vec)
+    // note : the window is one unit wider than the cut, the cut itself is applied below
+    auto outer_begin = std::lower_bound(outer_phi_order.begin(), outer_phi_order.end(), inner_i.phi - pre_phi_cut - 1,
+                                        [&temp_sPH_outer_nocolumn_vec](unsigned int index, double phi)
+                                        { return temp_sPH_outer_nocolumn_vec[index].phi < phi; });
+
+    outer_pair_index.clear();
+    for (auto iter = outer_begin; iter != outer_phi_order.end() && temp_sPH_outer_nocolumn_vec[*iter].phi <= inner_i.phi + pre_phi_cut + 1; ++iter)
     {
       // note : try to ease the analysis and also make it quick.
-      if (fabs(inner_i.phi - outer_i.phi) < 7)  // todo : the pre phi cut is here, can be optimized
+      if (fabs(inner_i.phi - temp_sPH_outer_nocolumn_vec[*iter].phi) < pre_phi_cut)
       {
-        cluster_pair_vec.push_back({{inner_i.x,
-                                     inner_i.y},
-                                    {outer_i.x,
-                                     outer_i.y}});
+        outer_pair_index.push_back(*iter);
       }
     }
+    std::sort(outer_pair_index.begin(), outer_pair_index.end());
+
+    for (const auto& outer_index : outer_pair_index)
+    {
+      const auto& outer_i = temp_sPH_outer_nocolumn_vec[outer_index];
+      cluster_pair_vec.push_back({{inner_i.x,
+                                   inner_i.y},
+                                  {outer_i.x,
+                                   outer_i.y}});
+    }
   }
 
   //-------------------------------
@@ -1667,11 +1689,15 @@ void INTTXYvtx::TH2FSampleLineFill(
   double angle;
   int n_seg = 0;
 
+  // note : the direction is the same for all the segments
+  angle = atan2(inner_clu.second - outer_clu.second, inner_clu.first - outer_clu.first);
+  const double cos_angle = cos(angle);
+  const double sin_angle = sin(angle);
+
   while (true)
   {
-    angle = atan2(inner_clu.second - outer_clu.second, inner_clu.first - outer_clu.first);
-    seg_x = (n_seg * segmentation) * cos(angle) + outer_clu.first;  // note : atan2(y,x), point.first is the radius
-    seg_y = (n_seg * segmentation) * sin(angle) + outer_clu.second;
+    seg_x = (n_seg * segmentation) * cos_angle + outer_clu.first;  // note : atan2(y,x), point.first is the radius
+    seg_y = (n_seg * segmentation) * sin_angle + outer_clu.second;
 
     if ((seg_x > x_min && seg_x < x_max && seg_y > y_min && seg_y < y_max) != true)
     {
@@ -1685,9 +1711,8 @@ void INTTXYvtx::TH2FSampleLineFill(
   n_seg = 1;
   while (true)
   {
-    angle = atan2(inner_clu.second - outer_clu.second, inner_clu.first - outer_clu.first);
-    seg_x = (-1 * n_seg * segmentation) * cos(angle) + outer_clu.first;  // note : atan2(y,x), point.first is the radius
-    seg_y = (-1 * n_seg * segmentation) * sin(angle) + outer_clu.second;
+    seg_x = (-1 * n_seg * segmentation) * cos_angle + outer_clu.first;  // note : atan2(y,x), point.first is the radius
+    seg_y = (-1 * n_seg * segmentation) * sin_angle + outer_clu.second;
 
     if ((seg_x > x_min && seg_x < x_max && seg_y > y_min && seg_y < y_max) != true)
     {
@@ -248,6 +248,8 @@ class INTTXYvtx
   // note : to keep the cluster pair information
   // note : this is the vector for the whole run, not event by event
   std::vector<std::pair<type_pos, type_pos>> cluster_pair_vec{};
+  std::vector<unsigned int> outer_phi_order{};   // note : outer cluster indices sorted in phi, ProcessEvt
+  std::vector<unsigned int> outer_pair_index{};  // note : outer clusters paired to one inner cluster, ProcessEvt
 
   double Clus_InnerPhi_Offset{0};
   double Clus_OuterPhi_Offset{0};
@@ -12,6 +12,7 @@
 #include <TTree.h>
 
 #include <algorithm>
+#include <array>
 #include <filesystem>
 #include <format>
 #include <iostream>
@@ -62,11 +63,6 @@ INTTZvtx::INTTZvtx(const std::string& runType,
   N_comb_phi.clear();
   // eff_N_comb.clear(); eff_z_mid.clear(); eff_N_comb_e.clear(); eff_z_range.clear(); // note : eff_sig
 
-  inner_clu_phi_map.clear();
-  outer_clu_phi_map.clear();
-  inner_clu_phi_map = std::vector<std::vector<std::pair<bool, clu_info>>>(360);
-  outer_clu_phi_map = std::vector<std::vector<std::pair<bool, clu_info>>>(360);
-
   ///////////
   //    Init();
 }
@@ -173,6 +169,7 @@ void INTTZvtx::InitHist()
   line_breakdown_hist->SetLineWidth(1);
   line_breakdown_hist->GetXaxis()->SetTitle("Z [mm]");
   line_breakdown_hist->GetYaxis()->SetTitle("Entry");
+  line_breakdown_diff.assign(line_breakdown_hist->GetNbinsX() + 3, 0);
   if (print_message_opt == true)
   {
     std::cout << "class INTTZvtx, Line breakdown hist, range : "
@@ -641,7 +638,9 @@ bool INTTZvtx::ProcessEvt(
     // std::cout<<"inner clu phi : "<<Clus_InnerPhi_Offset<<" origin: "<< temp_sPH_inner_nocolumn_vec[inner_i].phi <<std::endl;
     // std::cout<<" ("<<Clus_InnerPhi_Offset<<", "<< temp_sPH_inner_nocolumn_vec[inner_i].phi<<")" <<std::endl;
     //
-    inner_clu_phi_map[int(Clus_InnerPhi_Offset)].emplace_back(false, inner_i);
+    // note : the phi and radius are kept with the cluster, so that the pair loop below does not recompute them
+    inner_clu_phi_map[int(Clus_InnerPhi_Offset) % 360].push_back({inner_i, Clus_InnerPhi_Offset,
+                                                                  get_radius(inner_i.x - beam_origin.first, inner_i.y - beam_origin.second)});
 
     if (inner_i.z > 0)
     {
@@ -664,7 +663,8 @@ bool INTTZvtx::ProcessEvt(
                                        outer_i.x - beam_origin.first) *
                                      (180. / M_PI);
 
-    outer_clu_phi_map[int(Clus_OuterPhi_Offset)].emplace_back(false, outer_i);
+    outer_clu_phi_map[int(Clus_OuterPhi_Offset) % 360].push_back({outer_i, Clus_OuterPhi_Offset,
+                                                                  get_radius(outer_i.x - beam_origin.first, outer_i.y - beam_origin.second)});
 
     if (outer_i.z > 0)
     {
@@ -684,21 +684,9 @@ bool INTTZvtx::ProcessEvt(
   for (int inner_phi_i = 0; inner_phi_i < 360; inner_phi_i++)  // note : each phi cell (1 degree)
   {
     // note : N cluster in this phi cell
-    for (unsigned int inner_phi_clu_i = 0; inner_phi_clu_i < inner_clu_phi_map[inner_phi_i].size(); inner_phi_clu_i++)
+    for (const auto& inner_clu : inner_clu_phi_map[inner_phi_i])
     {
-      if (inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].first == true)
-      {
-        continue;
-      }
-
-      Clus_InnerPhi_Offset = (inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.y - beam_origin.second < 0)
-                                 ? atan2(inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.y - beam_origin.second,
-                                         inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.x - beam_origin.first) *
-                                           (180. / M_PI) +
-                                       360
-                                 : atan2(inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.y - beam_origin.second,
-                                         inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.x - beam_origin.first) *
-                                       (180. / M_PI);
+      Clus_InnerPhi_Offset = inner_clu.phi;
 
       // todo: change the outer phi scan range
       // note : the outer phi index, -1, 0, 1
@@ -725,21 +713,9 @@ bool INTTZvtx::ProcessEvt(
         }
         // end of nested condition readable translation
         // note : N clusters in that outer phi cell
-        for (unsigned int outer_phi_clu_i = 0; outer_phi_clu_i < outer_clu_phi_map[true_scan_i].size(); outer_phi_clu_i++)
+        for (const auto& outer_clu : outer_clu_phi_map[true_scan_i])
         {
-          if (outer_clu_phi_map[true_scan_i][outer_phi_clu_i].first == true)
-          {
-            continue;
-          }
-
-          Clus_OuterPhi_Offset = (outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.y - beam_origin.second < 0)
-                                     ? atan2(outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.y - beam_origin.second,
-                                             outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.x - beam_origin.first) *
-                                               (180. / M_PI) +
-                                           360
-                                     : atan2(outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.y - beam_origin.second,
-                                             outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.x - beam_origin.first) *
-                                           (180. / M_PI);
+          Clus_OuterPhi_Offset = outer_clu.phi;
 
           double delta_phi = get_delta_phi(Clus_InnerPhi_Offset, Clus_OuterPhi_Offset);
 
@@ -755,8 +731,8 @@ bool INTTZvtx::ProcessEvt(
           if (fabs(delta_phi) < phi_diff_cut)
           {
             double DCA_sign = calculateAngleBetweenVectors(
-                outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.x, outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.y,
-                inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.x, inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.y,
+                outer_clu.clu.x, outer_clu.clu.y,
+                inner_clu.clu.x, inner_clu.clu.y,
                 beam_origin.first, beam_origin.second);
             if (m_enable_qa)
             {
@@ -772,13 +748,9 @@ bool INTTZvtx::ProcessEvt(
               // note : we should set the offset first, otherwise it provides the bias
               // todo : which point should be used, DCA point or vertex xy ? Has to be studied
               std::pair<double, double> z_range_info = Get_possible_zvtx(
-                  0.,  // get_radius(beam_origin.first,beam_origin.second),
-                  {get_radius(inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.x - beam_origin.first,
-                              inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.y - beam_origin.second),
-                   inner_clu_phi_map[inner_phi_i][inner_phi_clu_i].second.z},  // note : unsign radius
-                  {get_radius(outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.x - beam_origin.first,
-                              outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.y - beam_origin.second),
-                   outer_clu_phi_map[true_scan_i][outer_phi_clu_i].second.z}  // note : unsign radius
+                  0.,                                    // get_radius(beam_origin.first,beam_origin.second),
+                  {inner_clu.radius, inner_clu.clu.z},  // note : unsign radius
+                  {outer_clu.radius, outer_clu.clu.z}   // note : unsign radius
               );
 
               // note : try to remove some crazy background candidates. Can be a todo
@@ -806,6 +778,9 @@ bool INTTZvtx::ProcessEvt(
     }
 
   }  // note : end of inner clu loop
+
+  // note : the lines were accumulated in an array, transfer them to the histogram once
+  fill_line_breakdown(line_breakdown_hist);
   //--std::cout<<"--4--"<<std::endl;
 
   // if (event_i == 906) {
@@ -1291,10 +1266,16 @@ void INTTZvtx::ClearEvt()
     evt_phi_diff_inner_phi->Reset("ICESM");
   }
 
-  inner_clu_phi_map.clear();
-  outer_clu_phi_map.clear();
-  inner_clu_phi_map = std::vector<std::vector<std::pair<bool, clu_info>>>(360);
-  outer_clu_phi_map = std::vector<std::vector<std::pair<bool, clu_info>>>(360);
+  for (auto& cell : inner_clu_phi_map)
+  {
+    cell.clear();
+  }
+  for (auto& cell : outer_clu_phi_map)
+  {
+    cell.clear();
+  }
+  line_breakdown_diff.assign(line_breakdown_diff.size(), 0);
+  line_breakdown_nset = 0;
 
   // note : this is the distribution for full run
   // line_breakdown_gaus_ratio_hist -> Reset("ICESM");
@@ -1666,10 +1647,10 @@ double INTTZvtx::Get_extrapolation(double given_y, double p0x, double p0y, doubl
   return xCoordinate;
 }
 
-std::pair<double, double> INTTZvtx::Get_possible_zvtx(double rvtx, std::vector<double> p0, std::vector<double> p1)  // note : inner p0, outer p1, vector {r,z}, -> {y,x}
+std::pair<double, double> INTTZvtx::Get_possible_zvtx(double rvtx, const std::array<double, 2>& p0, const std::array<double, 2>& p1)  // note : inner p0, outer p1, vector {r,z}, -> {y,x}
 {
-  std::vector<double> p0_z_edge = {(fabs(p0[1]) < 130) ? p0[1] - 8. : p0[1] - 10., (fabs(p0[1]) < 130) ? p0[1] + 8. : p0[1] + 10.};  // note : vector {left edge, right edge}
-  std::vector<double> p1_z_edge = {(fabs(p1[1]) < 130) ? p1[1] - 8. : p1[1] - 10., (fabs(p1[1]) < 130) ? p1[1] + 8. : p1[1] + 10.};  // note : vector {left edge, right edge}
+  const std::array<double, 2> p0_z_edge = {(fabs(p0[1]) < 130) ? p0[1] - 8. : p0[1] - 10., (fabs(p0[1]) < 130) ? p0[1] + 8. : p0[1] + 10.};  // note : vector {left edge, right edge}
+  const std::array<double, 2> p1_z_edge = {(fabs(p1[1]) < 130) ? p1[1] - 8. : p1[1] - 10., (fabs(p1[1]) < 130) ? p1[1] + 8. : p1[1] + 10.};  // note : vector {left edge, right edge}
 
   double edge_first = Get_extrapolation(rvtx, p0_z_edge[0], p0[0], p1_z_edge[1], p1[0]);
   double edge_second = Get_extrapolation(rvtx, p0_z_edge[1], p0[0], p1_z_edge[0], p1[0]);
@@ -1706,10 +1687,26 @@ void INTTZvtx::line_breakdown(TH1* hist_in, std::pair<double, double> line_range
   // std::cout<<"Digitize the bin : "<<first_bin<<" "<<last_bin<<std::endl;
 
   // note : if first:last = (0:0) or (N+1:N+1) -> the subtraction of them euqals to zero.
-  for (int i = 0; i < (last_bin - first_bin) + 1; i++)
+  // note : the bins first_bin to last_bin are incremented by one in fill_line_breakdown
+  line_breakdown_diff[first_bin] += 1;
+  line_breakdown_diff[last_bin + 1] -= 1;
+  line_breakdown_nset += (last_bin - first_bin) + 1;
+}
+
+void INTTZvtx::fill_line_breakdown(TH1* hist_in)
+{
+  int content = 0;
+  for (int i = 0; i < hist_in->GetNbinsX() + 2; i++)
   {
-    hist_in->SetBinContent(first_bin + i, hist_in->GetBinContent(first_bin + i) + 1);
+    content += line_breakdown_diff[i];
+    if (content != 0)
+    {
+      hist_in->SetBinContent(i, hist_in->GetBinContent(i) + content);
+    }
   }
+
+  // note : same number of entries as one SetBinContent per bin and line
+  hist_in->SetEntries(line_breakdown_nset);
 }
 
 // note : search_range : should be the gaus fit range
@@ -1852,8 +1849,8 @@ std::vector<double> INTTZvtx::find_Ngroup(TH1* hist_in)
 
 double INTTZvtx::get_delta_phi(double angle_1, double angle_2)
 {
-  std::vector<double> vec_abs = {fabs(angle_1 - angle_2), fabs(angle_1 - angle_2 + 360), fabs(angle_1 - angle_2 - 360)};
-  std::vector<double> vec = {(angle_1 - angle_2), (angle_1 - angle_2 + 360), (angle_1 - angle_2 - 360)};
+  const std::array<double, 3> vec_abs = {fabs(angle_1 - angle_2), fabs(angle_1 - angle_2 + 360), fabs(angle_1 - angle_2 - 360)};
+  const std::array<double, 3> vec = {(angle_1 - angle_2), (angle_1 - angle_2 + 360), (angle_1 - angle_2 - 360)};
   return vec[std::distance(vec_abs.begin(), std::min_element(vec_abs.begin(), vec_abs.end()))];
 }
 
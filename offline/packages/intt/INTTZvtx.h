@@ -3,6 +3,7 @@
 
 #include "InttVertexUtil.h"
 
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -140,8 +141,21 @@ class INTTZvtx
   double zvtx_hist_r = 500;               // histogram range for QA
   int print_rate = 50;                    // if_print in processEvt, todo : the print rate is here
 
-  std::vector<std::vector<std::pair<bool, clu_info>>> inner_clu_phi_map{};  // note: phi
-  std::vector<std::vector<std::pair<bool, clu_info>>> outer_clu_phi_map{};  // note: phi
+  // note : cluster with its phi [degree] and radius with respect to the beam origin, computed once per event
+  struct phi_clu_info
+  {
+    clu_info clu;
+    double phi{0};
+    double radius{0};
+  };
+
+  // note : clusters in 1 degree phi cells. The cells are cleared, not reallocated, between events
+  std::vector<std::vector<phi_clu_info>> inner_clu_phi_map{std::vector<std::vector<phi_clu_info>>(360)};
+  std::vector<std::vector<phi_clu_info>> outer_clu_phi_map{std::vector<std::vector<phi_clu_info>>(360)};
+
+  // note : line_breakdown_hist bin content increments, as differences between consecutive bins (under/overflow included)
+  std::vector<int> line_breakdown_diff{};
+  long line_breakdown_nset{0};
 
   ZvtxInfo m_zvtxinfo;
 
@@ -279,12 +293,13 @@ class INTTZvtx
   std::vector<float> z_range{};      // tracklet
 
   // function for analysis
-  std::pair<double, double> Get_possible_zvtx(double rvtx, std::vector<double> p0, std::vector<double> p1);
+  std::pair<double, double> Get_possible_zvtx(double rvtx, const std::array<double, 2>& p0, const std::array<double, 2>& p1);
   std::vector<double> find_Ngroup(TH1* hist_in);
   double get_radius(double x, double y);
   double calculateAngleBetweenVectors(double x1, double y1, double x2, double y2, double targetX, double targetY);
   double Get_extrapolation(double given_y, double p0x, double p0y, double p1x, double p1y);
   void line_breakdown(TH1* hist_in, std::pair<double, double> line_range);
+  void fill_line_breakdown(TH1* hist_in);
 
   // tracklet reco
   double get_delta_phi(double angle_1, double angle_2);
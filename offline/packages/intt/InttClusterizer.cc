@@ -29,9 +29,6 @@
 #include <phool/getClass.h>
 #include <phool/phool.h>
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/connected_components.hpp>
-
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -52,52 +49,6 @@ namespace
   }
 }  // namespace
 
-bool InttClusterizer::ladder_are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit*>& lhs, const std::pair<TrkrDefs::hitkey, TrkrHit*>& rhs, const int layer) const
-{
-  if (get_z_clustering(layer))
-  {
-    if (std::abs(InttDefs::getCol(lhs.first) - InttDefs::getCol(rhs.first)) <= 1)
-    {
-      if (std::abs(InttDefs::getRow(lhs.first) - InttDefs::getRow(rhs.first)) <= 1)
-      {
-        return true;
-      }
-    }
-  }
-  else if (std::abs(InttDefs::getCol(lhs.first) - InttDefs::getCol(rhs.first)) == 0)
-  {
-    if (std::abs(InttDefs::getRow(lhs.first) - InttDefs::getRow(rhs.first)) <= 1)
-    {
-      return true;
-    }
-  }
-
-  return false;
-}
-
-bool InttClusterizer::ladder_are_adjacent(RawHit* lhs, RawHit* rhs, const int layer) const
-{
-  if (get_z_clustering(layer))
-  {
-    if (std::abs((int) (lhs->getPhiBin()) - (int) (rhs->getPhiBin())) <= 1)  // col
-    {
-      if (std::abs((int) (lhs->getTBin()) - (int) (rhs->getTBin())) <= 1)  // Row
-      {
-        return true;
-      }
-    }
-  }
-  else if (std::abs((int) (lhs->getPhiBin()) - (int)(rhs->getPhiBin())) <= 1)
-  {
-    if (std::abs((int) (lhs->getTBin()) - (int) (rhs->getTBin())) == 0)
-    {
-      return true;
-    }
-  }
-
-  return false;
-}
-
 InttClusterizer::InttClusterizer(const std::string& name,
                                  unsigned int /*min_layer*/,
                                  unsigned int /*max_layer*/)
@@ -401,29 +352,15 @@ void InttClusterizer::ClusterLadderCells(PHCompositeNode* topNode)
       std::cout << "hitvec.size(): " << hitvec.size() << std::endl;
     }
 
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
-
     // Find adjacent strips
-    for (unsigned int i = 0; i < hitvec.size(); i++)
+    // without z clustering, strips are only connected along the same column
+    m_labeler.clear();
+    for (const auto& hit : hitvec)
     {
-      for (unsigned int j = i + 1; j < hitvec.size(); j++)
-      {
-        if (ladder_are_adjacent(hitvec[i], hitvec[j], layer))
-        {
-          add_edge(i, j, G);
-        }
-      }
-
-      add_edge(i, i, G);
+      m_labeler.add(InttDefs::getCol(hit.first), InttDefs::getRow(hit.first));
     }
-
-    // Find the connections between the vertices of the graph (vertices are the rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
-
-    // this is the actual clustering, performed by boost
-    connected_components(G, component.data());
+    m_labeler.label(get_z_clustering(layer) ? SiliconClusterLabeler::Connectivity::Box : SiliconClusterLabeler::Connectivity::Column);
+    const std::vector<int>& component = m_labeler.labels();
 
     // Loop over the components(hit cells) compiling a list of the
     // unique connected groups (ie. clusters).
@@ -482,13 +419,13 @@ void InttClusterizer::ClusterLadderCells(PHCompositeNode* topNode)
         // mapiter->second.second is the hit
         unsigned int hit_adc = (mapiter->second).second->getAdc();
 
-        // now get the positions from the geometry
+        // now get the positions from the strip center tables of the geometry
         double local_hit_location[3] = {0., 0., 0.};
 
 	// NOLINTNEXTLINE(readability-suspicious-call-argument)
-        geom->find_strip_center_localcoords(ladder_z_index,
-                                            row, col,
-                                            local_hit_location);
+        geom->get_strip_center_localcoords(ladder_z_index,
+                                           row, col,
+                                           local_hit_location);
 
         if (_make_e_weights[layer])
         {
@@ -670,29 +607,15 @@ void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
       std::cout << "hitvec.size(): " << hitvec.size() << std::endl;
     }
 
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
-
     // Find adjacent strips
-    for (unsigned int i = 0; i < hitvec.size(); i++)
+    // phi bin is the column, time bin the row. Without z clustering, strips are only connected along the same row
+    m_labeler.clear();
+    for (auto* hit : hitvec)
     {
-      for (unsigned int j = i + 1; j < hitvec.size(); j++)
-      {
-        if (ladder_are_adjacent(hitvec[i], hitvec[j], layer))
-        {
-          add_edge(i, j, G);
-        }
-      }
-
-      add_edge(i, i, G);
+      m_labeler.add(hit->getPhiBin(), hit->getTBin());
     }
-
-    // Find the connections between the vertices of the graph (vertices are the rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
-
-    // this is the actual clustering, performed by boost
-    connected_components(G, component.data());
+    m_labeler.label(get_z_clustering(layer) ? SiliconClusterLabeler::Connectivity::Box : SiliconClusterLabeler::Connectivity::Row);
+    const std::vector<int>& component = m_labeler.labels();
 
     // Loop over the components(hit cells) compiling a list of the
     // unique connected groups (ie. clusters).
@@ -769,13 +692,13 @@ void InttClusterizer::ClusterLadderCellsRaw(PHCompositeNode* topNode)
         // mapiter->second.second is the hit
         unsigned int hit_adc = (mapiter->second)->getAdc();
 
-        // now get the positions from the geometry
+        // now get the positions from the strip center tables of the geometry
         double local_hit_location[3] = {0., 0., 0.};
 
 	// NOLINTNEXTLINE(readability-suspicious-call-argument)
-        geom->find_strip_center_localcoords(ladder_z_index,
-                                            row, col,
-                                            local_hit_location);
+        geom->get_strip_center_localcoords(ladder_z_index,
+                                           row, col,
+                                           local_hit_location);
 
         if (_make_e_weights[layer])
         {
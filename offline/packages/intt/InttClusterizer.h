@@ -3,6 +3,7 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <trackbase/SiliconClusterLabeler.h>
 #include <trackbase/TrkrDefs.h>
 
 #include <limits>
@@ -78,8 +79,6 @@ class InttClusterizer : public SubsysReco
 
  private:
   bool record_ClusHitsVerbose{false};
-  bool ladder_are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit *> &lhs, const std::pair<TrkrDefs::hitkey, TrkrHit *> &rhs, const int layer) const;
-  bool ladder_are_adjacent(RawHit *lhs, RawHit *rhs, const int layer) const;
 
   void CalculateLadderThresholds(PHCompositeNode *topNode);
   void ClusterLadderCells(PHCompositeNode *topNode);
@@ -93,6 +92,9 @@ class InttClusterizer : public SubsysReco
   TrkrClusterHitAssoc *m_clusterhitassoc = nullptr;
   TrkrClusterCrossingAssoc *m_clustercrossingassoc = nullptr;
 
+  //! connected component labeling of the strips in one sensor
+  SiliconClusterLabeler m_labeler;
+
   // settings
   float _fraction_of_mip = 0.5;
   std::map<int, float> _thresholds_by_layer;  // layer->threshold
@@ -266,16 +266,24 @@ int MbdCalib::Download_Gains(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> qfit_integ = cdbttree->GetFloatColumn("qfit_integ");
+    CDBColumn<float> qfit_mpv = cdbttree->GetFloatColumn("qfit_mpv");
+    CDBColumn<float> qfit_sigma = cdbttree->GetFloatColumn("qfit_sigma");
+    CDBColumn<float> qfit_integerr = cdbttree->GetFloatColumn("qfit_integerr");
+    CDBColumn<float> qfit_mpverr = cdbttree->GetFloatColumn("qfit_mpverr");
+    CDBColumn<float> qfit_sigmaerr = cdbttree->GetFloatColumn("qfit_sigmaerr");
+    CDBColumn<float> qfit_chi2ndf = cdbttree->GetFloatColumn("qfit_chi2ndf");
 
     for (int ipmt = 0; ipmt < MbdDefs::MBD_N_PMT; ipmt++)
     {
-      _qfit_integ[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_integ");
-      _qfit_mpv[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_mpv");
-      _qfit_sigma[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_sigma");
-      _qfit_integerr[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_integerr");
-      _qfit_mpverr[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_mpverr");
-      _qfit_sigmaerr[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_sigmaerr");
-      _qfit_chi2ndf[ipmt] = cdbttree->GetFloatValue(ipmt, "qfit_chi2ndf");
+      _qfit_integ[ipmt] = qfit_integ(ipmt);
+      _qfit_mpv[ipmt] = qfit_mpv(ipmt);
+      _qfit_sigma[ipmt] = qfit_sigma(ipmt);
+      _qfit_integerr[ipmt] = qfit_integerr(ipmt);
+      _qfit_mpverr[ipmt] = qfit_mpverr(ipmt);
+      _qfit_sigmaerr[ipmt] = qfit_sigmaerr(ipmt);
+      _qfit_chi2ndf[ipmt] = qfit_chi2ndf(ipmt);
       if (Verbosity() > 0)
       {
         if (ipmt < 5)
@@ -343,13 +351,18 @@ int MbdCalib::Download_TQT0(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> tqfit_t0mean = cdbttree->GetFloatColumn("tqfit_t0mean");
+    CDBColumn<float> tqfit_t0meanerr = cdbttree->GetFloatColumn("tqfit_t0meanerr");
+    CDBColumn<float> tqfit_t0sigma = cdbttree->GetFloatColumn("tqfit_t0sigma");
+    CDBColumn<float> tqfit_t0sigmaerr = cdbttree->GetFloatColumn("tqfit_t0sigmaerr");
 
     for (int ipmt = 0; ipmt < MbdDefs::MBD_N_PMT; ipmt++)
     {
-      _tqfit_t0mean[ipmt] = cdbttree->GetFloatValue(ipmt, "tqfit_t0mean");
-      _tqfit_t0meanerr[ipmt] = cdbttree->GetFloatValue(ipmt, "tqfit_t0meanerr");
-      _tqfit_t0sigma[ipmt] = cdbttree->GetFloatValue(ipmt, "tqfit_t0sigma");
-      _tqfit_t0sigmaerr[ipmt] = cdbttree->GetFloatValue(ipmt, "tqfit_t0sigmaerr");
+      _tqfit_t0mean[ipmt] = tqfit_t0mean(ipmt);
+      _tqfit_t0meanerr[ipmt] = tqfit_t0meanerr(ipmt);
+      _tqfit_t0sigma[ipmt] = tqfit_t0sigma(ipmt);
+      _tqfit_t0sigmaerr[ipmt] = tqfit_t0sigmaerr(ipmt);
       if (Verbosity() > 0)
       {
         if (ipmt < 5 || ipmt >= MbdDefs::MBD_N_PMT - 5)
@@ -418,13 +431,18 @@ int MbdCalib::Download_TTT0(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> ttfit_t0mean = cdbttree->GetFloatColumn("ttfit_t0mean");
+    CDBColumn<float> ttfit_t0meanerr = cdbttree->GetFloatColumn("ttfit_t0meanerr");
+    CDBColumn<float> ttfit_t0sigma = cdbttree->GetFloatColumn("ttfit_t0sigma");
+    CDBColumn<float> ttfit_t0sigmaerr = cdbttree->GetFloatColumn("ttfit_t0sigmaerr");
 
     for (int ipmt = 0; ipmt < MbdDefs::MBD_N_PMT; ipmt++)
     {
-      _ttfit_t0mean[ipmt] = cdbttree->GetFloatValue(ipmt, "ttfit_t0mean");
-      _ttfit_t0meanerr[ipmt] = cdbttree->GetFloatValue(ipmt, "ttfit_t0meanerr");
-      _ttfit_t0sigma[ipmt] = cdbttree->GetFloatValue(ipmt, "ttfit_t0sigma");
-      _ttfit_t0sigmaerr[ipmt] = cdbttree->GetFloatValue(ipmt, "ttfit_t0sigmaerr");
+      _ttfit_t0mean[ipmt] = ttfit_t0mean(ipmt);
+      _ttfit_t0meanerr[ipmt] = ttfit_t0meanerr(ipmt);
+      _ttfit_t0sigma[ipmt] = ttfit_t0sigma(ipmt);
+      _ttfit_t0sigmaerr[ipmt] = ttfit_t0sigmaerr(ipmt);
 
       if (Verbosity() > 0)
       {
@@ -592,13 +610,18 @@ int MbdCalib::Download_Ped(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> pedmean = cdbttree->GetFloatColumn("pedmean");
+    CDBColumn<float> pedmeanerr = cdbttree->GetFloatColumn("pedmeanerr");
+    CDBColumn<float> pedsigma = cdbttree->GetFloatColumn("pedsigma");
+    CDBColumn<float> pedsigmaerr = cdbttree->GetFloatColumn("pedsigmaerr");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
-      _pedmean[ifeech] = cdbttree->GetFloatValue(ifeech, "pedmean");
-      _pedmeanerr[ifeech] = cdbttree->GetFloatValue(ifeech, "pedmeanerr");
-      _pedsigma[ifeech] = cdbttree->GetFloatValue(ifeech, "pedsigma");
-      _pedsigmaerr[ifeech] = cdbttree->GetFloatValue(ifeech, "pedsigmaerr");
+      _pedmean[ifeech] = pedmean(ifeech);
+      _pedmeanerr[ifeech] = pedmeanerr(ifeech);
+      _pedsigma[ifeech] = pedsigma(ifeech);
+      _pedsigmaerr[ifeech] = pedsigmaerr(ifeech);
 
       if (Verbosity() > 0)
       {
@@ -659,10 +682,12 @@ int MbdCalib::Download_SampMax(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> sampmax = cdbttree->GetIntColumn("sampmax");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
-      _sampmax[ifeech] = cdbttree->GetIntValue(ifeech, "sampmax");
+      _sampmax[ifeech] = sampmax(ifeech);
       if (Verbosity() > 0)
       {
         if (ifeech < 5 || ifeech >= MbdDefs::MBD_N_FEECH - 5)
@@ -721,10 +746,12 @@ int MbdCalib::Download_Status(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> status = cdbttree->GetIntColumn("status");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
-      _mbdstatus[ifeech] = cdbttree->GetIntValue(ifeech, "status");
+      _mbdstatus[ifeech] = status(ifeech);
       if (Verbosity() > 0)
       {
         if (ifeech < 5 || ifeech >= MbdDefs::MBD_N_FEECH - 5)
@@ -807,6 +834,15 @@ int MbdCalib::Download_Shapes(const std::string& dbase_location)
     }
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> shape_npts = cdbttree->GetIntColumn("shape_npts");
+    CDBColumn<float> shape_min = cdbttree->GetFloatColumn("shape_min");
+    CDBColumn<float> shape_max = cdbttree->GetFloatColumn("shape_max");
+    CDBColumn<int> sherr_npts = cdbttree->GetIntColumn("sherr_npts");
+    CDBColumn<float> sherr_min = cdbttree->GetFloatColumn("sherr_min");
+    CDBColumn<float> sherr_max = cdbttree->GetFloatColumn("sherr_max");
+    CDBColumn<float> shape_val = cdbttree->GetFloatColumn("shape_val");
+    CDBColumn<float> sherr_val = cdbttree->GetFloatColumn("sherr_val");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
@@ -815,22 +851,22 @@ int MbdCalib::Download_Shapes(const std::string& dbase_location)
         continue;  // skip t-channels
       }
 
-      _shape_npts[ifeech] = cdbttree->GetIntValue(ifeech, "shape_npts");
-      _shape_minrange[ifeech] = cdbttree->GetFloatValue(ifeech, "shape_min");
-      _shape_maxrange[ifeech] = cdbttree->GetFloatValue(ifeech, "shape_max");
+      _shape_npts[ifeech] = shape_npts(ifeech);
+      _shape_minrange[ifeech] = shape_min(ifeech);
+      _shape_maxrange[ifeech] = shape_max(ifeech);
 
-      _sherr_npts[ifeech] = cdbttree->GetIntValue(ifeech, "sherr_npts");
-      _sherr_minrange[ifeech] = cdbttree->GetFloatValue(ifeech, "sherr_min");
-      _sherr_maxrange[ifeech] = cdbttree->GetFloatValue(ifeech, "sherr_max");
+      _sherr_npts[ifeech] = sherr_npts(ifeech);
+      _sherr_minrange[ifeech] = sherr_min(ifeech);
+      _sherr_maxrange[ifeech] = sherr_max(ifeech);
 
       for (int ipt = 0; ipt < _shape_npts[ifeech]; ipt++)
       {
         int chtemp = (1000 * ipt) + ifeech;
 
-        float val = cdbttree->GetFloatValue(chtemp, "shape_val");
+        float val = shape_val(chtemp);
         _shape_y[ifeech].push_back(val);
 
-        val = cdbttree->GetFloatValue(chtemp, "sherr_val");
+        val = sherr_val(chtemp);
         _sherr_yerr[ifeech].push_back(val);
       }
 
@@ -996,6 +1032,11 @@ int MbdCalib::Download_TimeCorr(const std::string& dbase_location)
     }
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> tcorr_npts = cdbttree->GetIntColumn("tcorr_npts");
+    CDBColumn<float> tcorr_min = cdbttree->GetFloatColumn("tcorr_min");
+    CDBColumn<float> tcorr_max = cdbttree->GetFloatColumn("tcorr_max");
+    CDBColumn<float> tcorr_val = cdbttree->GetFloatColumn("tcorr_val");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
@@ -1004,15 +1045,15 @@ int MbdCalib::Download_TimeCorr(const std::string& dbase_location)
         continue;  // skip q-channels
       }
 
-      _tcorr_npts[ifeech] = cdbttree->GetIntValue(ifeech, "tcorr_npts");
-      _tcorr_minrange[ifeech] = cdbttree->GetFloatValue(ifeech, "tcorr_min");
-      _tcorr_maxrange[ifeech] = cdbttree->GetFloatValue(ifeech, "tcorr_max");
+      _tcorr_npts[ifeech] = tcorr_npts(ifeech);
+      _tcorr_minrange[ifeech] = tcorr_min(ifeech);
+      _tcorr_maxrange[ifeech] = tcorr_max(ifeech);
 
       for (int ipt=0; ipt<_tcorr_npts[ifeech]; ipt++)
       {
         int chtemp = (1000*ipt) + ifeech; // in cdbtree, entry has id = 1000*datapoint + ifeech
 
-        float val = cdbttree->GetFloatValue(chtemp, "tcorr_val");
+        float val = tcorr_val(chtemp);
         _tcorr_y[ifeech].push_back( val );
       }
 
@@ -1155,6 +1196,11 @@ int MbdCalib::Download_SlewCorr(const std::string& dbase_location)
     }
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> scorr_npts = cdbttree->GetIntColumn("scorr_npts");
+    CDBColumn<float> scorr_min = cdbttree->GetFloatColumn("scorr_min");
+    CDBColumn<float> scorr_max = cdbttree->GetFloatColumn("scorr_max");
+    CDBColumn<float> scorr_val = cdbttree->GetFloatColumn("scorr_val");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
@@ -1163,15 +1209,15 @@ int MbdCalib::Download_SlewCorr(const std::string& dbase_location)
         continue;  // skip q-channels
       }
 
-      _scorr_npts[ifeech] = cdbttree->GetIntValue(ifeech, "scorr_npts");
-      _scorr_minrange[ifeech] = cdbttree->GetFloatValue(ifeech, "scorr_min");
-      _scorr_maxrange[ifeech] = cdbttree->GetFloatValue(ifeech, "scorr_max");
+      _scorr_npts[ifeech] = scorr_npts(ifeech);
+      _scorr_minrange[ifeech] = scorr_min(ifeech);
+      _scorr_maxrange[ifeech] = scorr_max(ifeech);
 
       for (int ipt=0; ipt<_scorr_npts[ifeech]; ipt++)
       {
         int chtemp = (1000*ipt) + ifeech; // in cdbtree, entry has id = 1000*datapoint + ifeech
 
-        float val = cdbttree->GetFloatValue(chtemp, "scorr_val");
+        float val = scorr_val(chtemp);
         _scorr_y[ifeech].push_back( val );
       }
 
@@ -1327,6 +1373,11 @@ int MbdCalib::Download_TimeRMS(const std::string& dbase_location)
     }
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<int> trms_npts = cdbttree->GetIntColumn("trms_npts");
+    CDBColumn<float> trms_min = cdbttree->GetFloatColumn("trms_min");
+    CDBColumn<float> trms_max = cdbttree->GetFloatColumn("trms_max");
+    CDBColumn<float> trms_val = cdbttree->GetFloatColumn("trms_val");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
@@ -1335,15 +1386,15 @@ int MbdCalib::Download_TimeRMS(const std::string& dbase_location)
         continue;  // skip q-channels
       }
 
-      _trms_npts[ifeech] = cdbttree->GetIntValue(ifeech, "trms_npts");
-      _trms_minrange[ifeech] = cdbttree->GetFloatValue(ifeech, "trms_min");
-      _trms_maxrange[ifeech] = cdbttree->GetFloatValue(ifeech, "trms_max");
+      _trms_npts[ifeech] = trms_npts(ifeech);
+      _trms_minrange[ifeech] = trms_min(ifeech);
+      _trms_maxrange[ifeech] = trms_max(ifeech);
 
       for (int ipt=0; ipt<_trms_npts[ifeech]; ipt++)
       {
         int chtemp = (1000*ipt) + ifeech; // in cdbtree, entry has id = 1000*datapoint + ifeech
 
-        float val = cdbttree->GetFloatValue(chtemp, "trms_val");
+        float val = trms_val(chtemp);
         _trms_y[ifeech].push_back( val );
       }
 
@@ -1499,16 +1550,24 @@ int MbdCalib::Download_Pileup(const std::string& dbase_location)
       return _status;
     }
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> pileup_p0 = cdbttree->GetFloatColumn("pileup_p0");
+    CDBColumn<float> pileup_p0err = cdbttree->GetFloatColumn("pileup_p0err");
+    CDBColumn<float> pileup_p1 = cdbttree->GetFloatColumn("pileup_p1");
+    CDBColumn<float> pileup_p1err = cdbttree->GetFloatColumn("pileup_p1err");
+    CDBColumn<float> pileup_p2 = cdbttree->GetFloatColumn("pileup_p2");
+    CDBColumn<float> pileup_p2err = cdbttree->GetFloatColumn("pileup_p2err");
+    CDBColumn<float> pileup_chi2ndf = cdbttree->GetFloatColumn("pileup_chi2ndf");
 
     for (int ifeech = 0; ifeech < MbdDefs::MBD_N_FEECH; ifeech++)
     {
-      _pileup_p0[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p0");
-      _pileup_p0err[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p0err");
-      _pileup_p1[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p1");
-      _pileup_p1err[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p1err");
-      _pileup_p2[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p2");
-      _pileup_p2err[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_p2err");
-      _pileup_chi2ndf[ifeech] = cdbttree->GetFloatValue(ifeech, "pileup_chi2ndf");
+      _pileup_p0[ifeech] = pileup_p0(ifeech);
+      _pileup_p0err[ifeech] = pileup_p0err(ifeech);
+      _pileup_p1[ifeech] = pileup_p1(ifeech);
+      _pileup_p1err[ifeech] = pileup_p1err(ifeech);
+      _pileup_p2[ifeech] = pileup_p2(ifeech);
+      _pileup_p2err[ifeech] = pileup_p2err(ifeech);
+      _pileup_chi2ndf[ifeech] = pileup_chi2ndf(ifeech);
       if (Verbosity() > 0)
       {
         if (ifeech < 2 || ifeech >= (MbdDefs::MBD_N_FEECH-2) )
@@ -1578,16 +1637,24 @@ int MbdCalib::Download_Thresholds(const std::string& dbase_location)
   {
     CDBTTree* cdbttree = new CDBTTree(dbase_location);
     cdbttree->LoadCalibrations();
+    // fetch each field once as column, not with a map lookup per channel
+    CDBColumn<float> thresh_mean = cdbttree->GetFloatColumn("thresh_mean");
+    CDBColumn<float> thresh_meanerr = cdbttree->GetFloatColumn("thresh_meanerr");
+    CDBColumn<float> thresh_width = cdbttree->GetFloatColumn("thresh_width");
+    CDBColumn<float> thresh_widtherr = cdbttree->GetFloatColumn("thresh_widtherr");
+    CDBColumn<float> thresh_eff = cdbttree->GetFloatColumn("thresh_eff");
+    CDBColumn<float> thresh_efferr = cdbttree->GetFloatColumn("thresh_efferr");
+    CDBColumn<float> thresh_chi2ndf = cdbttree->GetFloatColumn("thresh_chi2ndf");
 
     for (int ipmt = 0; ipmt < MbdDefs::MBD_N_PMT; ipmt++)
     {
-      _thresh_mean[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_mean");
-      _thresh_meanerr[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_meanerr");
-      _thresh_width[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_width");
-      _thresh_widtherr[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_widtherr");
-      _thresh_eff[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_eff");
-      _thresh_efferr[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_efferr");
-      _thresh_chi2ndf[ipmt] = cdbttree->GetFloatValue(ipmt, "thresh_chi2ndf");
+      _thresh_mean[ipmt] = thresh_mean(ipmt);
+      _thresh_meanerr[ipmt] = thresh_meanerr(ipmt);
+      _thresh_width[ipmt] = thresh_width(ipmt);
+      _thresh_widtherr[ipmt] = thresh_widtherr(ipmt);
+      _thresh_eff[ipmt] = thresh_eff(ipmt);
+      _thresh_efferr[ipmt] = thresh_efferr(ipmt);
+      _thresh_chi2ndf[ipmt] = thresh_chi2ndf(ipmt);
       if (Verbosity() > 0)
       {
         if (ipmt < 5)
@@ -168,6 +168,40 @@ TVector3 CylinderGeom_Mvtx::get_local_coords_from_pixel(int iRow, int iCol)
   return local;
 }
 
+const std::vector<double>& CylinderGeom_Mvtx::get_row_local_x()
+{
+  if (m_row_local_x.empty())
+  {
+    build_pixel_tables();
+  }
+  return m_row_local_x;
+}
+
+const std::vector<double>& CylinderGeom_Mvtx::get_col_local_z()
+{
+  if (m_col_local_z.empty())
+  {
+    build_pixel_tables();
+  }
+  return m_col_local_z;
+}
+
+void CylinderGeom_Mvtx::build_pixel_tables()
+{
+  // local x only depends on the row and local z only on the column.
+  // Filled from get_local_coords_from_pixel to get bitwise the same values
+  m_row_local_x.resize(get_NX());
+  for (int row = 0; row < get_NX(); ++row)
+  {
+    m_row_local_x[row] = get_local_coords_from_pixel(row, 0).X();
+  }
+  m_col_local_z.resize(get_NZ());
+  for (int col = 0; col < get_NZ(); ++col)
+  {
+    m_col_local_z[col] = get_local_coords_from_pixel(0, col).Z();
+  }
+}
+
 void CylinderGeom_Mvtx::identify(std::ostream& os) const
 {
   os << "CylinderGeom_Mvtx: layer: " << layer
@@ -7,6 +7,7 @@
 #include <TVector3.h>
 
 #include <iostream>
+#include <vector>
 
 class CylinderGeom_Mvtx : public PHG4CylinderGeom
 {
@@ -53,6 +54,30 @@ class CylinderGeom_Mvtx : public PHG4CylinderGeom
   TVector3 get_local_coords_from_pixel(int NXZ);
   TVector3 get_local_coords_from_pixel(int iRow, int iCol);
 
+  //! local x of the center of each pixel row and local z of each pixel column,
+  //! same values as get_local_coords_from_pixel. Built on first use, not streamed
+  const std::vector<double>& get_row_local_x();
+  const std::vector<double>& get_col_local_z();
+
+  //! local x and z of a pixel center from the cached tables
+  void get_local_xz_from_pixel(int iRow, int iCol, double& x, double& z)
+  {
+    if (m_row_local_x.empty())
+    {
+      build_pixel_tables();
+    }
+    if (iRow < 0 || iRow >= (int) m_row_local_x.size() || iCol < 0 || iCol >= (int) m_col_local_z.size())
+    {
+      // out of range, let get_local_coords_from_pixel complain
+      const TVector3 local = get_local_coords_from_pixel(iRow, iCol);
+      x = local.X();
+      z = local.Z();
+      return;
+    }
+    x = m_row_local_x[iRow];
+    z = m_col_local_z[iCol];
+  }
+
   int get_pixel_X_from_pixel_number(int NXZ) const;
 
   int get_pixel_Z_from_pixel_number(int NXZ) const;
@@ -94,6 +119,13 @@ class CylinderGeom_Mvtx : public PHG4CylinderGeom
   double pixel_z;
   double pixel_thickness;
 
+ private:
+  void build_pixel_tables();
+
+  //! pixel center tables, the local positions do not depend on the alignment
+  std::vector<double> m_row_local_x;  //!
+  std::vector<double> m_col_local_z;  //!
+
   ClassDefOverride(CylinderGeom_Mvtx, 2)
 };
 
@@ -42,17 +42,12 @@
 #include <TMatrixTUtils.h>  // for TMatrixTRow
 #include <TVector3.h>
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
-#include <boost/graph/adjacency_list.hpp>
-#pragma GCC diagnostic pop
-
-#include <boost/graph/connected_components.hpp>
-
 #include <array>
 #include <cmath>
 #include <cstdlib>  // for exit
 #include <iostream>
+#include <iterator>  // for distance
+#include <limits>
 #include <map>  // for multimap<>::iterator
 #include <set>  // for set, set<>::iterator
 #include <string>
@@ -69,49 +64,6 @@ namespace
   }
 }  // namespace
 
-bool MvtxClusterizer::are_adjacent(
-    const std::pair<TrkrDefs::hitkey, TrkrHit *> &lhs,
-    const std::pair<TrkrDefs::hitkey, TrkrHit *> &rhs) const
-{
-  if (GetZClustering())
-  {
-    return
-
-        // column adjacent
-        ((MvtxDefs::getCol(lhs.first) > MvtxDefs::getCol(rhs.first)) ? MvtxDefs::getCol(lhs.first) <= MvtxDefs::getCol(rhs.first) + 1 : MvtxDefs::getCol(rhs.first) <= MvtxDefs::getCol(lhs.first) + 1) &&
-
-        // row adjacent
-        ((MvtxDefs::getRow(lhs.first) > MvtxDefs::getRow(rhs.first)) ? MvtxDefs::getRow(lhs.first) <= MvtxDefs::getRow(rhs.first) + 1 : MvtxDefs::getRow(rhs.first) <= MvtxDefs::getRow(lhs.first) + 1);
-  }
-  return
-      // column identical
-      MvtxDefs::getCol(rhs.first) == MvtxDefs::getCol(lhs.first) &&
-
-      // row adjacent
-      ((MvtxDefs::getRow(lhs.first) > MvtxDefs::getRow(rhs.first)) ? MvtxDefs::getRow(lhs.first) <= MvtxDefs::getRow(rhs.first) + 1 : MvtxDefs::getRow(rhs.first) <= MvtxDefs::getRow(lhs.first) + 1);
-}
-
-bool MvtxClusterizer::are_adjacent(RawHit *lhs, RawHit *rhs) const
-{
-  if (GetZClustering())
-  {
-    return
-
-        // phi adjacent (== column)
-        ((lhs->getPhiBin() > rhs->getPhiBin()) ? lhs->getPhiBin() <= rhs->getPhiBin() + 1 : rhs->getPhiBin() <= lhs->getPhiBin() + 1) &&
-
-        // time adjacent (== row)
-        ((lhs->getTBin() > rhs->getTBin()) ? lhs->getTBin() <= rhs->getTBin() + 1 : rhs->getTBin() <= lhs->getTBin() + 1);
-  }
-  return
-
-      // phi identical (== column)
-      lhs->getPhiBin() == rhs->getPhiBin() &&
-
-      // time adjacent (== row)
-      ((lhs->getTBin() > rhs->getTBin()) ? lhs->getTBin() <= rhs->getTBin() + 1 : rhs->getTBin() <= lhs->getTBin() + 1);
-}
-
 MvtxClusterizer::MvtxClusterizer(const std::string &name)
   : SubsysReco(name)
 {
@@ -353,28 +305,15 @@ void MvtxClusterizer::ClusterMvtx(PHCompositeNode *topNode)
     }
 
     // do the clustering
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
-
-    // loop over hits in this chip
-    for (unsigned int i = 0; i < hitvec.size(); i++)
+    // hits are connected if they share an edge or a corner, or, without z clustering,
+    // if they are in the same column and adjacent rows
+    m_labeler.clear();
+    for (const auto &hit : hitvec)
     {
-      for (unsigned int j = 0; j < hitvec.size(); j++)
-      {
-        if (are_adjacent(hitvec[i], hitvec[j]))
-        {
-          add_edge(i, j, G);
-        }
-      }
+      m_labeler.add(MvtxDefs::getCol(hit.first), MvtxDefs::getRow(hit.first));
     }
-
-    // Find the connections between the vertices of the graph (vertices are the
-    // rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
-
-    // this is the actual clustering, performed by boost
-    boost::connected_components(G, component.data());
+    m_labeler.label(GetZClustering() ? SiliconClusterLabeler::Connectivity::Box : SiliconClusterLabeler::Connectivity::Column);
+    const std::vector<int> &component = m_labeler.labels();
 
     // Loop over the components(hits) compiling a list of the
     // unique connected groups (ie. clusters).
@@ -438,20 +377,15 @@ void MvtxClusterizer::ClusterMvtx(PHCompositeNode *topNode)
           }
         }
 
-        // get local coordinates, in stae reference frame, for hit
-        auto local_coords = layergeom->get_local_coords_from_pixel(row, col);
-
-        /*
-          manually offset position along y (thickness of the sensor),
-          to account for effective hit position in the sensor, resulting from
-          diffusion.
-          Effective position corresponds to 1um above the middle of the sensor
-        */
-        local_coords.SetY(1e-4);
+        // get local coordinates, in stave reference frame, for hit
+        // from the pixel center tables of the geometry
+        double locx = 0;
+        double locz = 0;
+        layergeom->get_local_xz_from_pixel(row, col, locx, locz);
 
         // update cluster position
-        locxsum += local_coords.X();
-        loczsum += local_coords.Z();
+        locxsum += locx;
+        loczsum += locz;
         // add the association between this cluster key and this hitkey to the
         // table
         m_clusterhitassoc->addAssoc(ckey, mapiter->second.first);
@@ -655,28 +589,14 @@ void MvtxClusterizer::ClusterMvtxRaw(PHCompositeNode *topNode)
     }
 
     // do the clustering
-    using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::undirectedS>;
-    Graph G;
-
-    // loop over hits in this chip
-    for (unsigned int i = 0; i < hitvec.size(); i++)
+    // phi bin is the column, time bin the row
+    m_labeler.clear();
+    for (auto *hit : hitvec)
     {
-      for (unsigned int j = 0; j < hitvec.size(); j++)
-      {
-        if (are_adjacent(hitvec[i], hitvec[j]))
-        {
-          add_edge(i, j, G);
-        }
-      }
+      m_labeler.add(hit->getPhiBin(), hit->getTBin());
     }
-
-    // Find the connections between the vertices of the graph (vertices are the
-    // rawhits,
-    // connections are made when they are adjacent to one another)
-    std::vector<int> component(num_vertices(G));
-
-    // this is the actual clustering, performed by boost
-    boost::connected_components(G, component.data());
+    m_labeler.label(GetZClustering() ? SiliconClusterLabeler::Connectivity::Box : SiliconClusterLabeler::Connectivity::Column);
+    const std::vector<int> &component = m_labeler.labels();
 
     // Loop over the components(hits) compiling a list of the
     // unique connected groups (ie. clusters).
@@ -728,20 +648,15 @@ void MvtxClusterizer::ClusterMvtxRaw(PHCompositeNode *topNode)
         zbins.insert(col);
         phibins.insert(row);
 
-        // get local coordinates, in stae reference frame, for hit
-        auto local_coords = layergeom->get_local_coords_from_pixel(row, col);
-
-        /*
-          manually offset position along y (thickness of the sensor),
-          to account for effective hit position in the sensor, resulting from
-          diffusion.
-          Effective position corresponds to 1um above the middle of the sensor
-        */
-        local_coords.SetY(1e-4);
+        // get local coordinates, in stave reference frame, for hit
+        // from the pixel center tables of the geometry
+        double locx = 0;
+        double locz = 0;
+        layergeom->get_local_xz_from_pixel(row, col, locx, locz);
 
         // update cluster position
-        locxsum += local_coords.X();
-        loczsum += local_coords.Z();
+        locxsum += locx;
+        loczsum += locz;
         // add the association between this cluster key and this hitkey to the
         // table
         //	      m_clusterhitassoc->addAssoc(ckey, mapiter->second.first);
@@ -8,6 +8,7 @@
 #define MVTX_MVTXCLUSTERIZER_H
 
 #include <fun4all/SubsysReco.h>
+#include <trackbase/SiliconClusterLabeler.h>
 #include <trackbase/TrkrCluster.h>
 #include <trackbase/TrkrDefs.h>
 
@@ -63,10 +64,7 @@ class MvtxClusterizer : public SubsysReco
   ClusHitsVerbose *mClusHitsVerbose{nullptr};
 
  private:
-  // bool are_adjacent(const pixel lhs, const pixel rhs);
   bool record_ClusHitsVerbose{false};
-  bool are_adjacent(const std::pair<TrkrDefs::hitkey, TrkrHit *> &lhs, const std::pair<TrkrDefs::hitkey, TrkrHit *> &rhs) const;
-  bool are_adjacent(RawHit *lhs, RawHit *rhs) const;
 
   void ClusterMvtx(PHCompositeNode *topNode);
   void ClusterMvtxRaw(PHCompositeNode *topNode);
@@ -79,6 +77,9 @@ class MvtxClusterizer : public SubsysReco
 
   TrkrClusterHitAssoc *m_clusterhitassoc {nullptr};
 
+  //! connected component labeling of the hits in one chip
+  SiliconClusterLabeler m_labeler;
+
   // settings
   bool m_makeZClustering {true};  // z_clustering_option
   bool do_hit_assoc {true};
@@ -43,6 +43,37 @@
 #include <memory>
 #include <utility>
 
+namespace
+{
+  // binning of the per FEE ADC spectra, as the TH2C used before
+  constexpr int adc_nbins = 501;
+  constexpr double adc_min = -0.5;
+  constexpr double adc_max = 1000.5;
+  constexpr int adc_ncells = adc_nbins + 2;  // with under- and overflow
+  constexpr uint8_t adc_maxcount = 127;      // TH2C bin contents saturate at 127
+  constexpr double adc_binwidth = (adc_max - adc_min) / adc_nbins;
+
+  //! same as TAxis::FindBin
+  int adc_bin(double adc)
+  {
+    if (adc < adc_min)
+    {
+      return 0;
+    }
+    if (!(adc < adc_max))
+    {
+      return adc_nbins + 1;
+    }
+    return 1 + int(adc_nbins * (adc - adc_min) / (adc_max - adc_min));
+  }
+
+  //! same as TAxis::GetBinCenter, also outside of the axis range
+  double adc_bin_center(int bin)
+  {
+    return adc_min + (bin - 1) * adc_binwidth + 0.5 * adc_binwidth;
+  }
+}  // namespace
+
 TpcCombinedRawDataUnpacker::TpcCombinedRawDataUnpacker(std::string const& name, std::string const& outF)
   : SubsysReco(name)
   , outfile_name(outF)
@@ -331,17 +362,19 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
     {
       std::cout << "TpcCombinedRawDataUnpacker:: do zero suppression" << std::endl;
     }
-    TH2* feehist = nullptr;
     hpedestal = 60;
     hpedwidth = m_zs_threshold[region];
 
     unsigned int pad_key = create_pad_key(side, layer, phibin);
 
+    // baseline correction uses the FEE that first reported this pad
+    unsigned int chan_fee = fee;
     std::map<unsigned int, chan_info>::iterator chan_it = chan_map.find(pad_key);
     if (chan_it != chan_map.end())
     {
       (*chan_it).second.ped = hpedestal;
       (*chan_it).second.width = hpedwidth;
+      chan_fee = (*chan_it).second.fee;
     }
     else
     {
@@ -353,24 +386,15 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
     }
     int rx = get_rx(layer);
     unsigned int fee_key = create_fee_key(side, mc_sectors[sector % 12], rx, fee);
-    // find or insert TH2C;
-    std::map<unsigned int, TH2*>::iterator fee_map_it;
-
-    fee_map_it = feeadc_map.find(fee_key);
-    if (fee_map_it != feeadc_map.end())
+    fee_adc_info* feeadc = nullptr;
+    int fee_index = -1;
+    if (m_do_baseline_corr)
     {
-      feehist = (*fee_map_it).second;
+      fee_index = get_fee_index(fee_key, max_time_range + 1);
+      feeadc = &m_fee_adc[fee_index];
     }
-    else
-    {
-      std::string histname = "h" + std::to_string(fee_key);
-      feehist = new TH2C(histname.c_str(), "histname", max_time_range + 1, -0.5, max_time_range + 0.5, 501, -0.5, 1000.5);
-      feeadc_map.insert(std::make_pair(fee_key, feehist));
-      std::vector<int> feeentries(feehist->GetNbinsX(), 0);
-      feeentries_map.insert(std::make_pair(fee_key, feeentries));
-    }
-    auto fee_entries_it = feeentries_map.find(fee_key);
-    std::vector<int>& fee_entries_vec = (*fee_entries_it).second;
+    const unsigned int chan_fee_key = create_fee_key(side, mc_sectors[sector % 12], rx, chan_fee);
+    const int chan_fee_index = (chan_fee_key == fee_key) ? fee_index : -1;
 
     double threshold_cut = m_zs_threshold[region];
 
@@ -387,14 +411,11 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
         {
           continue;
         }
-        if (feehist != nullptr)
+        if (adc > 0)
         {
-          if (adc > 0)
+          if ((double(adc) - hpedestal) > threshold_cut)
           {
-            if ((double(adc) - hpedestal) > threshold_cut)
-            {
-              nhitschan++;
-            }
+            nhitschan++;
           }
         }
       }
@@ -420,16 +441,20 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
       {
         continue;
       }
-      if (feehist != nullptr)
+      if (feeadc != nullptr)
       {
         if (adc > 0)
         {
           if ((double(adc) - hpedestal) > threshold_cut)
           {
-            feehist->Fill(t, adc - hpedestal);
-            if (t < (int) fee_entries_vec.size())
+            if (t < feeadc->ntimebins)
             {
-              fee_entries_vec[t]++;
+              uint8_t& count = feeadc->counts[t * adc_ncells + adc_bin(adc - hpedestal)];
+              if (count < adc_maxcount)
+              {
+                count++;
+              }
+              feeadc->entries[t]++;
             }
           }
         }
@@ -445,6 +470,17 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
           hit = new TrkrHitv2();
           hit->setAdc(double(adc) - hpedestal);
           hit_set_container_itr->second->addHitSpecificKey(hit_key, hit);
+          if (m_do_baseline_corr)
+          {
+            baseline_hit bhit;
+            bhit.hit = hit;
+            bhit.hitsetkey = hit_set_key;
+            bhit.hitkey = hit_key;
+            bhit.fee = chan_fee;
+            bhit.fee_key = chan_fee_key;
+            bhit.fee_index = chan_fee_index;
+            m_baseline_hits.push_back(bhit);
+          }
         }
 
         if (m_writeTree)
@@ -480,92 +516,8 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
 
     int nhistfilled = 0;
     int nhisttotal = 0;
-    for (auto& hiter : feeadc_map)
-    {
-      if (hiter.second != nullptr)
-      {
-        unsigned int fee_key = hiter.first;
-        unsigned int side;
-        unsigned int sector;
-        unsigned int rx;
-        unsigned int fee;
-        unpack_fee_key(side, sector, rx, fee, fee_key);
-        TH2* hist2d = hiter.second;
-        std::map<unsigned int, std::vector<int>>::iterator fee_entries_it = feeentries_map.find(fee_key);
-        if (fee_entries_it == feeentries_map.end())
-        {
-          continue;
-          //	  fee_entries_vec_it = (*fee_entries_it).second.begin();
-        }
-        std::vector<int>::iterator fee_entries_vec_it = (*fee_entries_it).second.begin();
-
-        std::vector<double> pedvec(hist2d->GetNbinsX(), 0);
-        feebaseline_map.insert(std::make_pair(hiter.first, pedvec));
-        std::map<unsigned int, std::vector<double>>::iterator fee_blm_it = feebaseline_map.find(hiter.first);
-        (*fee_blm_it).second.resize(hist2d->GetNbinsX(), 0);
-        for (int binx = 1; binx < hist2d->GetNbinsX(); binx++)
-        {
-          double timebin = (hist2d->GetXaxis())->GetBinCenter(binx);
-          std::string histname1d = "h" + std::to_string(hiter.first) + "_" + std::to_string((int) timebin);
-          nhisttotal++;
-          double local_ped = 0;
-          double local_width = 0;
-          double entries = fee_entries_vec_it[timebin];
-          if (fee_entries_vec_it[timebin] > 100)
-          {
-            nhistfilled++;
-
-            TH1D* hist1d = hist2d->ProjectionY(histname1d.c_str(), binx, binx);
-            if (hist1d->GetEntries() != fee_entries_vec_it[timebin])
-            {
-              std::cout << " vec " << fee_entries_vec_it[timebin]
-                        << " hist " << hist1d->GetEntries()
-                        << std::endl;
-            }
-            if (hist1d->GetEntries() > 10)
-            {
-              int maxbin = hist1d->GetMaximumBin();
-              // calc peak position
-              double hadc_sum = 0.0;
-              double hibin_sum = 0.0;
-              double hibin2_sum = 0.0;
-
-              for (int isum = -3; isum <= 3; isum++)
-              {
-                double val = hist1d->GetBinContent(maxbin + isum);
-                double center = hist1d->GetBinCenter(maxbin + isum);
-                hibin_sum += center * val;
-                hibin2_sum += center * center * val;
-                hadc_sum += val;
-              }
-              local_ped = hibin_sum / hadc_sum;
-              local_width = sqrt((hibin2_sum / hadc_sum) - (local_ped * local_ped));
-            }
-            delete hist1d;
-          }
-          (*fee_blm_it).second[(int) timebin] = local_ped + m_baseline_nsigma * local_width;
+    calculate_baselines(nhistfilled, nhisttotal);
 
-          if (m_writeTree)
-          {
-            float fXh[11];
-            int nh = 0;
-
-            fXh[nh++] = _ievent - 1;
-            fXh[nh++] = 0;                        // gtm_bco;
-            fXh[nh++] = 0;                        // packet_id;
-            fXh[nh++] = 0;                        // ep;
-            fXh[nh++] = mc_sectors[sector % 12];  // Sector;
-            fXh[nh++] = side;
-            fXh[nh++] = fee;
-            fXh[nh++] = rx;
-            fXh[nh++] = entries;
-            fXh[nh++] = local_ped;
-            fXh[nh++] = local_width;
-            m_ntup->Fill(fXh);
-          }
-        }
-      }
-    }
     if (Verbosity() >= 1)
     {
       std::cout << " filled " << nhistfilled
@@ -575,100 +527,84 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
       std::cout << "second loop " << m_do_baseline_corr << std::endl;
     }
 
-    // second loop over hits to apply baseline correction
-    TrkrHitSetContainer::ConstRange hitsetrange;
-    hitsetrange = trkr_hit_set_container->getHitSets(TrkrDefs::TrkrId::tpcId);
-
-    for (TrkrHitSetContainer::ConstIterator hitsetitr = hitsetrange.first;
-         hitsetitr != hitsetrange.second;
-         ++hitsetitr)
+    // apply baseline correction to the hits created in this event
+    if (m_writeTree)
     {
-      // if(count>0)continue;
-      TrkrHitSet* hitset = hitsetitr->second;
-      unsigned int layer = TrkrDefs::getLayer(hitsetitr->first);
-      int side = TpcDefs::getSide(hitsetitr->first);
-      unsigned int sector = TpcDefs::getSectorId(hitsetitr->first);
-
-      TrkrHitSet::ConstRange hitrangei = hitset->getHits();
-
-      for (TrkrHitSet::ConstIterator hitr = hitrangei.first;
-           hitr != hitrangei.second;
-           ++hitr)
+      // keep the hitset container order for the corrected hit ntuple
+      std::sort(m_baseline_hits.begin(), m_baseline_hits.end(),
+                [](const baseline_hit& lhs, const baseline_hit& rhs)
+                { return (lhs.hitsetkey < rhs.hitsetkey) || (lhs.hitsetkey == rhs.hitsetkey && lhs.hitkey < rhs.hitkey); });
+    }
+    for (auto& bhit : m_baseline_hits)
+    {
+      int fee_index = bhit.fee_index;
+      if (fee_index < 0)
       {
-        unsigned short phibin = TpcDefs::getPad(hitr->first);
-        unsigned short tbin = TpcDefs::getTBin(hitr->first);
-        unsigned short adc = (hitr->second->getAdc());
-
-        unsigned int pad_key = create_pad_key(side, layer, phibin);
-
-        double fee = 0;
-        std::map<unsigned int, chan_info>::iterator chan_it = chan_map.find(pad_key);
-        if (chan_it != chan_map.end())
+        auto fee_index_it = fee_index_map.find(bhit.fee_key);
+        if (fee_index_it == fee_index_map.end())
         {
-          chan_info cinfo = (*chan_it).second;
-          fee = cinfo.fee;
-          // hpedestal2 = cinfo.ped;
-          // hpedwidth2 = cinfo.width;
+          continue;
         }
+        fee_index = fee_index_it->second;
+      }
+      const std::vector<double>& baseline = m_fee_adc[fee_index].baseline;
 
-        int rx = get_rx(layer);
-        double corr = 0;
-
-        unsigned int fee_key = create_fee_key(side, sector, rx, fee);
-        std::map<unsigned int, std::vector<double>>::iterator fee_blm_it = feebaseline_map.find(fee_key);
-        if (fee_blm_it != feebaseline_map.end())
-        {
-          if (tbin < (int) (*fee_blm_it).second.size())
-          {
-            corr = (*fee_blm_it).second[tbin];
-          }
-          hitr->second->setAdc(0);
-          double nuadc = (double(adc) - corr);
-          nuadc = std::max<double>(nuadc, 0);
-          hitr->second->setAdc(nuadc);
+      unsigned short tbin = TpcDefs::getTBin(bhit.hitkey);
+      unsigned short adc = bhit.hit->getAdc();
+      double corr = 0;
+      if (tbin < (int) baseline.size())
+      {
+        corr = baseline[tbin];
+      }
+      double nuadc = (double(adc) - corr);
+      nuadc = std::max<double>(nuadc, 0);
+      bhit.hit->setAdc(nuadc);
 
-          if (m_writeTree)
-          {
-            float fXh[18];
-            int nh = 0;
-
-            fXh[nh++] = _ievent - 1;
-            fXh[nh++] = 0;       // gtm_bco;
-            fXh[nh++] = 0;       // packet_id;
-            fXh[nh++] = 0;       // ep;
-            fXh[nh++] = sector;  // mc_sectors[sector % 12];//Sector;
-            fXh[nh++] = side;
-            fXh[nh++] = fee;
-            fXh[nh++] = 0;  // channel;
-            fXh[nh++] = 0;  // sampadd;
-            fXh[nh++] = 0;  // sampch;
-            fXh[nh++] = (double) phibin;
-            fXh[nh++] = (double) tbin;
-            fXh[nh++] = layer;
-            fXh[nh++] = double(adc);
-            fXh[nh++] = 0;  // hpedestal2;
-            fXh[nh++] = 0;  // hpedwidth2;
-            fXh[nh++] = corr;
-
-            m_ntup_hits_corr->Fill(fXh);
-          }
-        }
+      if (m_writeTree)
+      {
+        unsigned int layer = TrkrDefs::getLayer(bhit.hitsetkey);
+        int side = TpcDefs::getSide(bhit.hitsetkey);
+        unsigned int sector = TpcDefs::getSectorId(bhit.hitsetkey);
+        unsigned short phibin = TpcDefs::getPad(bhit.hitkey);
+
+        float fXh[18];
+        int nh = 0;
+
+        fXh[nh++] = _ievent - 1;
+        fXh[nh++] = 0;       // gtm_bco;
+        fXh[nh++] = 0;       // packet_id;
+        fXh[nh++] = 0;       // ep;
+        fXh[nh++] = sector;  // mc_sectors[sector % 12];//Sector;
+        fXh[nh++] = side;
+        fXh[nh++] = bhit.fee;
+        fXh[nh++] = 0;  // channel;
+        fXh[nh++] = 0;  // sampadd;
+        fXh[nh++] = 0;  // sampch;
+        fXh[nh++] = (double) phibin;
+        fXh[nh++] = (double) tbin;
+        fXh[nh++] = layer;
+        fXh[nh++] = double(adc);
+        fXh[nh++] = 0;  // hpedestal2;
+        fXh[nh++] = 0;  // hpedwidth2;
+        fXh[nh++] = corr;
+
+        m_ntup_hits_corr->Fill(fXh);
       }
     }
   }
-  // reset histogramms
-  for (auto& hiter2 : feeadc_map)
+  // reset ADC spectra, only time bins which got entries were touched
+  for (auto& feeadc : m_fee_adc)
   {
-    if (hiter2.second != nullptr)
+    for (int t = 0; t < feeadc.ntimebins; t++)
     {
-      hiter2.second->Reset();
+      if (feeadc.entries[t] > 0)
+      {
+        std::fill_n(feeadc.counts.begin() + t * adc_ncells, adc_ncells, 0);
+        feeadc.entries[t] = 0;
+      }
     }
   }
-  feebaseline_map.clear();
-  for (auto& hiter_entries : feeentries_map)
-  {
-    hiter_entries.second.assign(hiter_entries.second.size(), 0);
-  }
+  m_baseline_hits.clear();
 
   if (Verbosity())
   {
@@ -679,6 +615,105 @@ int TpcCombinedRawDataUnpacker::process_event(PHCompositeNode* topNode)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+int TpcCombinedRawDataUnpacker::get_fee_index(unsigned int fee_key, int ntimebins)
+{
+  auto fee_index_it = fee_index_map.find(fee_key);
+  if (fee_index_it != fee_index_map.end())
+  {
+    return fee_index_it->second;
+  }
+  fee_adc_info feeadc;
+  feeadc.fee_key = fee_key;
+  feeadc.ntimebins = ntimebins;
+  feeadc.counts.assign(ntimebins * adc_ncells, 0);
+  feeadc.entries.assign(ntimebins, 0);
+  feeadc.baseline.assign(ntimebins, 0);
+  m_fee_adc.push_back(feeadc);
+  const int fee_index = m_fee_adc.size() - 1;
+  fee_index_map.insert(std::make_pair(fee_key, fee_index));
+  return fee_index;
+}
+
+void TpcCombinedRawDataUnpacker::calculate_baselines(int& nhistfilled, int& nhisttotal)
+{
+  // fee_key order, for the ntuple
+  for (const auto& [fee_key, fee_index] : fee_index_map)
+  {
+    unsigned int side;
+    unsigned int sector;
+    unsigned int rx;
+    unsigned int fee;
+    unpack_fee_key(side, sector, rx, fee, fee_key);
+    fee_adc_info& feeadc = m_fee_adc[fee_index];
+
+    feeadc.baseline.assign(feeadc.ntimebins, 0);
+    // the last time bin never gets a baseline, as before
+    for (int timebin = 0; timebin < feeadc.ntimebins - 1; timebin++)
+    {
+      nhisttotal++;
+      double local_ped = 0;
+      double local_width = 0;
+      double entries = feeadc.entries[timebin];
+      if (feeadc.entries[timebin] > 100)
+      {
+        nhistfilled++;
+        const uint8_t* counts = &feeadc.counts[timebin * adc_ncells];
+        auto content = [counts](int bin)
+        { return (double) counts[std::clamp(bin, 0, adc_ncells - 1)]; };
+
+        double sum = 0;
+        int maxbin = 1;  // first maximum, as TH1::GetMaximumBin
+        for (int bin = 1; bin <= adc_nbins; bin++)
+        {
+          sum += counts[bin];
+          if (counts[bin] > counts[maxbin])
+          {
+            maxbin = bin;
+          }
+        }
+        if (sum > 10)
+        {
+          // calc peak position
+          double hadc_sum = 0.0;
+          double hibin_sum = 0.0;
+          double hibin2_sum = 0.0;
+
+          for (int isum = -3; isum <= 3; isum++)
+          {
+            double val = content(maxbin + isum);
+            double center = adc_bin_center(maxbin + isum);
+            hibin_sum += center * val;
+            hibin2_sum += center * center * val;
+            hadc_sum += val;
+          }
+          local_ped = hibin_sum / hadc_sum;
+          local_width = sqrt((hibin2_sum / hadc_sum) - (local_ped * local_ped));
+        }
+      }
+      feeadc.baseline[timebin] = local_ped + m_baseline_nsigma * local_width;
+
+      if (m_writeTree)
+      {
+        float fXh[11];
+        int nh = 0;
+
+        fXh[nh++] = _ievent - 1;
+        fXh[nh++] = 0;                        // gtm_bco;
+        fXh[nh++] = 0;                        // packet_id;
+        fXh[nh++] = 0;                        // ep;
+        fXh[nh++] = mc_sectors[sector % 12];  // Sector;
+        fXh[nh++] = side;
+        fXh[nh++] = fee;
+        fXh[nh++] = rx;
+        fXh[nh++] = entries;
+        fXh[nh++] = local_ped;
+        fXh[nh++] = local_width;
+        m_ntup->Fill(fXh);
+      }
+    }
+  }
+}
+
 int TpcCombinedRawDataUnpacker::End(PHCompositeNode* /*topNode*/)
 {
   if (m_writeTree)
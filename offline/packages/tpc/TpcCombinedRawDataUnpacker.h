@@ -5,6 +5,9 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <trackbase/TrkrDefs.h>
+
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <string>
@@ -17,6 +20,7 @@ class TFile;
 class TH1;
 class TH2;
 class TNtuple;
+class TrkrHit;
 
 class TpcCombinedRawDataUnpacker : public SubsysReco
 {
@@ -92,6 +96,38 @@ class TpcCombinedRawDataUnpacker : public SubsysReco
     double width = -1;
     int entries = 0;
   };
+
+  //! ADC spectra of one FEE per time bin, used for the local baseline correction
+  /*!
+   * flat replacement of the per FEE TH2C, same binning: time bins -0.5 .. ntimebins-0.5,
+   * 501 ADC bins from -0.5 to 1000.5 plus under- and overflow, counts saturate at 127
+   */
+  struct fee_adc_info
+  {
+    unsigned int fee_key = 0;
+    int ntimebins = 0;
+    std::vector<uint8_t> counts;   // ntimebins x adc cells
+    std::vector<int> entries;      // per time bin
+    std::vector<double> baseline;  // per time bin, recalculated each event
+  };
+
+  //! hit created in the current event, with the FEE whose baseline is subtracted
+  struct baseline_hit
+  {
+    TrkrHit *hit = nullptr;
+    TrkrDefs::hitsetkey hitsetkey = 0;
+    TrkrDefs::hitkey hitkey = 0;
+    unsigned int fee = 0;
+    unsigned int fee_key = 0;
+    int fee_index = -1;  // -1 if the FEE still has to be looked up by fee_key
+  };
+
+  //! index of fee_key in m_fee_adc, new entry with ntimebins time bins if not yet seen
+  int get_fee_index(unsigned int fee_key, int ntimebins);
+
+  //! calculate the local baselines of all FEEs from this event's ADC spectra
+  void calculate_baselines(int &nhistfilled, int &nhisttotal);
+
   TNtuple *m_ntup{nullptr};
   TNtuple *m_ntup_hits{nullptr};
   TNtuple *m_ntup_hits_corr{nullptr};
@@ -123,9 +159,9 @@ class TpcCombinedRawDataUnpacker : public SubsysReco
   std::string m_TpcRawNodeName{"TPCRAWHIT"};
   std::string outfile_name;
   std::map<unsigned int, chan_info> chan_map;                  // stays in place
-  std::map<unsigned int, TH2 *> feeadc_map;                    // histos reset after each event
-  std::map<unsigned int, std::vector<int>> feeentries_map;     // cleared after each event
-  std::map<unsigned int, std::vector<double>> feebaseline_map;  // cleared after each event
+  std::map<unsigned int, int> fee_index_map;  // fee_key -> m_fee_adc index, stays in place
+  std::vector<fee_adc_info> m_fee_adc;        // contents reset after each event
+  std::vector<baseline_hit> m_baseline_hits;  // cleared after each event
 };
 
 #endif  // TPC_COMBINEDRAWDATAUNPACKER_H
@@ -22,6 +22,7 @@
 #include <fun4all/Fun4AllReturnCodes.h>
 
 #include <phool/PHCompositeNode.h>
+#include <phool/PHTimer.h>
 #include <phool/getClass.h>
 #include <phool/phool.h>
 
@@ -954,6 +955,89 @@ std::vector<int> TpcCentralMembraneMatching::doGlobalRMatching(TH2* r_phi, bool
   return hitMatches;
 }
 
+void TpcCentralMembraneMatching::buildTruthIndex()
+{
+  for (int s = 0; s < 2; ++s)
+  {
+    m_truth_cloud[s].pts.clear();
+    m_truth_cloud[s].truth_index.clear();
+  }
+
+  // truth pads are stored with z = +1 (side 1) or z = -1 (side 0)
+  for (int i = 0; i < (int) m_truth_pos.size(); ++i)
+  {
+    const auto& truth = m_truth_pos[i];
+    const double tZ = truth.Z();
+    if (tZ <= 0)
+    {
+      m_truth_cloud[0].pts.push_back({truth.X(), truth.Y()});
+      m_truth_cloud[0].truth_index.push_back(i);
+    }
+    if (tZ >= 0)
+    {
+      m_truth_cloud[1].pts.push_back({truth.X(), truth.Y()});
+      m_truth_cloud[1].truth_index.push_back(i);
+    }
+  }
+
+  for (int s = 0; s < 2; ++s)
+  {
+    m_truth_kdtree[s] = std::make_unique<TruthKDTree>(2, m_truth_cloud[s], nanoflann::KDTreeSingleIndexAdaptorParams(10));
+    m_truth_kdtree[s]->buildIndex();
+  }
+}
+
+int TpcCentralMembraneMatching::findLocalTruthMatch(const TVector3& reco, bool side) const
+{
+  static constexpr double max_dR = 5.0;
+  static constexpr double max_dphi = 0.05;
+
+  const double rR = get_r(reco.X(), reco.Y());
+  const double rPhi = reco.Phi();
+
+  // any pad inside the (dR, dphi) window is closer than this in x,y
+  const double max_dist2 = (square(max_dR) + 2 * (rR + max_dR) * rR * (1 - std::cos(max_dphi))) * 1.01 + 1e-6;
+
+  const auto& cloud = m_truth_cloud[side ? 1 : 0];
+  const std::array<double, 2> query = {reco.X(), reco.Y()};
+  std::vector<std::pair<size_t, double>> candidates;
+  m_truth_kdtree[side ? 1 : 0]->radiusSearch(query.data(), max_dist2, candidates, nanoflann::SearchParams(32, 0, false));
+
+  // visit the candidates in truth order so that ties resolve as in a plain scan over m_truth_pos
+  std::sort(candidates.begin(), candidates.end());
+
+  double minNNDist = 100000.0;
+  int match_localTruth = -1;
+  for (const auto& candidate : candidates)
+  {
+    const int truth_index = cloud.truth_index[candidate.first];
+    const auto& truth = m_truth_pos[truth_index];
+    double tR = get_r(truth.X(), truth.Y());
+    double tPhi = truth.Phi();
+
+    auto dR = fabs(tR - rR);
+    if (dR > max_dR)
+    {
+      continue;
+    }
+
+    auto dphi = delta_phi(tPhi - rPhi);
+    if (fabs(dphi) > max_dphi)
+    {
+      continue;
+    }
+
+    double dist = sqrt(pow(truth.X() - reco.X(), 2) + pow(truth.Y() - reco.Y(), 2));
+    if (dist < minNNDist)
+    {
+      minNNDist = dist;
+      match_localTruth = truth_index;
+    }
+  }
+
+  return match_localTruth;
+}
+
 int TpcCentralMembraneMatching::getClusterRMatch(double clusterR, int side)
 {
   double closestDist = 100.;
@@ -1117,6 +1201,9 @@ int TpcCentralMembraneMatching::InitRun(PHCompositeNode* topNode)
 
   }
 
+  // spatial index of the truth pads, for the nearest neighbour matching
+  buildTruthIndex();
+
   //const double phi_petal = M_PI / 9.0;  // angle span of one petal
 
   /*
@@ -1893,67 +1980,42 @@ int TpcCentralMembraneMatching::process_event(PHCompositeNode* topNode)
   }  // end fancy
   else
   {
-    int reco_index = 0;
-    for (const auto& reco : reco_pos)
-    {
-      double rR = get_r(reco.X(), reco.Y());
-      double rPhi = reco.Phi();
-      bool side = reco_side[reco_index];
-
-      truth_index = 0;
-      double minNNDist = 100000.0;
-      int match_localTruth = -1;
-      for (const auto& truth : m_truth_pos)
-      {
-        // std::cout << "reco_index " << reco_index << "   truth_index " << truth_index << std::endl;
-        double tR = get_r(truth.X(), truth.Y());
-        double tPhi = truth.Phi();
-        double tZ = truth.Z();
-
-        if ((!side && tZ > 0) || (side && tZ < 0))
-        {
-          truth_index++;
-          continue;
-        }
-
-        auto dR = fabs(tR - rR);
-        if (dR > 5.0)
-        {
-          truth_index++;
-          continue;
-        }
-
-        auto dphi = delta_phi(tPhi - rPhi);
-        if (fabs(dphi) > 0.05)
-        {
-          truth_index++;
-          continue;
-        }
+    PHTimer timer("CMMatchingTimer");
+    timer.restart();
 
-        double dist = sqrt(pow(truth.X() - reco.X(), 2) + pow(truth.Y() - reco.Y(), 2));
-        if (dist < minNNDist)
-        {
-          minNNDist = dist;
-          match_localTruth = truth_index;
-        }
-        truth_index++;
-      }  // end truth loop
+    // find the closest truth pad of each reco cluster. Reco clusters are independent of each other
+    std::vector<int> localTruthMatch(reco_pos.size(), -1);
+#pragma omp parallel for
+    for (int reco_index = 0; reco_index < (int) reco_pos.size(); ++reco_index)
+    {
+      localTruthMatch[reco_index] = findLocalTruthMatch(reco_pos[reco_index], reco_side[reco_index]);
+    }
 
+    for (int reco_index = 0; reco_index < (int) reco_pos.size(); ++reco_index)
+    {
+      const int match_localTruth = localTruthMatch[reco_index];
       if (match_localTruth == -1)
       {
-        reco_index++;
         continue;
       }
 
+      const auto& reco = reco_pos[reco_index];
       truth_NNRecoIndex[match_localTruth].push_back(reco_index);
       NNDist[reco_index] = sqrt(pow(m_truth_pos[match_localTruth].X() - reco.X(), 2) + pow(m_truth_pos[match_localTruth].Y() - reco.Y(), 2));
       NNR[reco_index] = get_r(m_truth_pos[match_localTruth].X(), m_truth_pos[match_localTruth].Y());
       NNPhi[reco_index] = m_truth_pos[match_localTruth].Phi();
       NNIndex[reco_index] = m_truth_index[match_localTruth];
-
-      reco_index++;
     }  // end reco loop
 
+    timer.stop();
+    m_matching_time += timer.elapsed();
+    ++m_matching_events;
+    if (Verbosity() > 1)
+    {
+      std::cout << "TpcCentralMembraneMatching::process_event - nearest truth search for " << reco_pos.size()
+                << " clusters took " << timer.elapsed() << " ms" << std::endl;
+    }
+
     truth_index = 0;
     for (const auto& truthIndex : truth_NNRecoIndex)
     {
@@ -2408,6 +2470,12 @@ int TpcCentralMembraneMatching::End(PHCompositeNode* /*topNode*/)
 {
   std::cout << PHWHERE << "starting TpcCentralMembraneMatching::End()" << std::endl;
 
+  if (m_matching_events > 0)
+  {
+    std::cout << PHWHERE << " nearest truth search: " << m_matching_events << " events, "
+              << m_matching_time / m_matching_events << " ms per event" << std::endl;
+  }
+
   // write distortion corrections
   if (m_dcc_out_aggregated)
   {
@@ -17,11 +17,16 @@
 
 #include <fun4all/SubsysReco.h>
 
+#include <trackreco/nanoflann.hpp>
+
 #include <TGraph.h>
 #include <TGraph2D.h>
 
+#include <array>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 class PHCompositeNode;
 class CMFlashDifferenceContainer;
@@ -415,6 +420,53 @@ class TpcCentralMembraneMatching : public SubsysReco
   bool m_skipOutliers{false};
   bool m_manualInterp{false};
 
+  /// truth pad centers of one side of the central membrane, as a nanoflann point cloud
+  struct TruthPointCloud
+  {
+    std::vector<std::array<double, 2>> pts;
+
+    /// position of each point in m_truth_pos
+    std::vector<int> truth_index;
+
+    size_t kdtree_get_point_count() const
+    {
+      return pts.size();
+    }
+
+    double kdtree_distance(const double *p1, const size_t idx_p2, size_t /*size*/) const
+    {
+      const double d0 = p1[0] - pts[idx_p2][0];
+      const double d1 = p1[1] - pts[idx_p2][1];
+      return d0 * d0 + d1 * d1;
+    }
+
+    double kdtree_get_pt(const size_t idx, int dim) const
+    {
+      return pts[idx][dim];
+    }
+
+    template <class BBOX>
+    bool kdtree_get_bbox(BBOX & /*bb*/) const
+    {
+      return false;
+    }
+  };
+
+  using TruthKDTree = nanoflann::KDTreeSingleIndexAdaptor<nanoflann::L2_Simple_Adaptor<double, TruthPointCloud>, TruthPointCloud, 2>;
+
+  /// fill the per-side truth point clouds and build their kd-trees
+  void buildTruthIndex();
+
+  /// index in m_truth_pos of the closest truth pad within the matching window, -1 if none
+  int findLocalTruthMatch(const TVector3 &reco, bool side) const;
+
+  std::array<TruthPointCloud, 2> m_truth_cloud;
+  std::array<std::unique_ptr<TruthKDTree>, 2> m_truth_kdtree;
+
+  /// accumulated time (ms) spent in nearest truth search, and number of events
+  double m_matching_time{0};
+  int m_matching_events{0};
+
   std::vector<double> m_reco_RPeaks[2];
   double m_m[2]{};
   double m_b[2]{};
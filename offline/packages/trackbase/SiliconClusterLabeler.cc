@@ -0,0 +1,143 @@
+#include "SiliconClusterLabeler.h"
+
+#include <algorithm>
+
+//_________________________________________________________________
+void SiliconClusterLabeler::clear()
+{
+  m_cells.clear();
+  m_labels.clear();
+}
+
+//_________________________________________________________________
+void SiliconClusterLabeler::add(uint16_t col, uint16_t row)
+{
+  const unsigned int index = m_cells.size();
+  m_cells.push_back({make_key(col, row), index});
+}
+
+//_________________________________________________________________
+unsigned int SiliconClusterLabeler::find(unsigned int i)
+{
+  while (m_parent[i] != i)
+  {
+    m_parent[i] = m_parent[m_parent[i]];
+    i = m_parent[i];
+  }
+  return i;
+}
+
+//_________________________________________________________________
+void SiliconClusterLabeler::merge(unsigned int i, unsigned int j)
+{
+  const auto root_i = find(i);
+  const auto root_j = find(j);
+  if (root_i == root_j)
+  {
+    return;
+  }
+
+  // keep the lowest hit index as root
+  if (root_i < root_j)
+  {
+    m_parent[root_j] = root_i;
+  }
+  else
+  {
+    m_parent[root_i] = root_j;
+  }
+}
+
+//_________________________________________________________________
+void SiliconClusterLabeler::merge_with(const Cell &cell, uint32_t key)
+{
+  auto iter = std::lower_bound(m_sorted.cbegin(), m_sorted.cend(), key,
+                               [](const Cell &lhs, uint32_t rhs)
+                               { return lhs.key < rhs; });
+  for (; iter != m_sorted.cend() && iter->key == key; ++iter)
+  {
+    merge(cell.index, iter->index);
+  }
+}
+
+//_________________________________________________________________
+unsigned int SiliconClusterLabeler::label(Connectivity connectivity)
+{
+  const unsigned int nhits = m_cells.size();
+
+  m_parent.resize(nhits);
+  for (unsigned int i = 0; i < nhits; ++i)
+  {
+    m_parent[i] = i;
+  }
+
+  // sort by column, then row
+  m_sorted = m_cells;
+  std::sort(m_sorted.begin(), m_sorted.end(), [](const Cell &lhs, const Cell &rhs)
+            { return lhs.key < rhs.key; });
+
+  // every connected pair is seen once, from the cell with the larger key
+  for (const auto &cell : m_sorted)
+  {
+    const uint16_t col = cell.key >> 16U;
+    const uint16_t row = cell.key & 0xFFFFU;
+
+    // duplicated cells are always connected
+    merge_with(cell, cell.key);
+
+    switch (connectivity)
+    {
+    case Connectivity::Box:
+      if (row > 0)
+      {
+        merge_with(cell, make_key(col, row - 1));
+      }
+      if (col > 0)
+      {
+        if (row > 0)
+        {
+          merge_with(cell, make_key(col - 1, row - 1));
+        }
+        merge_with(cell, make_key(col - 1, row));
+        if (row < 0xFFFFU)
+        {
+          merge_with(cell, make_key(col - 1, row + 1));
+        }
+      }
+      break;
+
+    case Connectivity::Column:
+      if (row > 0)
+      {
+        merge_with(cell, make_key(col, row - 1));
+      }
+      break;
+
+    case Connectivity::Row:
+      if (col > 0)
+      {
+        merge_with(cell, make_key(col - 1, row));
+      }
+      break;
+    }
+  }
+
+  // number the clusters in order of their first hit
+  // since roots are the lowest hit index of each cluster, a root is always seen before the other hits
+  m_labels.assign(nhits, -1);
+  int nclusters = 0;
+  for (unsigned int i = 0; i < nhits; ++i)
+  {
+    const auto root = find(i);
+    if (root == i)
+    {
+      m_labels[i] = nclusters++;
+    }
+    else
+    {
+      m_labels[i] = m_labels[root];
+    }
+  }
+
+  return nclusters;
+}
@@ -0,0 +1,80 @@
+// Tell emacs that this is a C++ source
+//  -*- C++ -*-.
+#ifndef TRACKBASE_SILICONCLUSTERLABELER_H
+#define TRACKBASE_SILICONCLUSTERLABELER_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Connected component labeling of silicon hits in a single hitset
+ *
+ * Hits are added as (column, row) cells. label() sorts them once,
+ * finds the already visited neighbors of each cell with a binary search
+ * and merges them with a union-find, in O(n log n) instead of testing
+ * every hit pair.
+ *
+ * Cluster ids are numbered in order of the first hit of each cluster,
+ * in the order the hits were added. This is the numbering of
+ * boost::connected_components on the equivalent hit-pair graph, so the
+ * resulting cluster keys are unchanged.
+ *
+ * The object keeps its buffers between hitsets to avoid reallocations.
+ */
+class SiliconClusterLabeler
+{
+ public:
+  /// which cells are connected
+  enum class Connectivity
+  {
+    /// |dcol| <= 1 and |drow| <= 1
+    Box,
+    /// same column, |drow| <= 1
+    Column,
+    /// same row, |dcol| <= 1
+    Row
+  };
+
+  /// remove all hits
+  void clear();
+
+  /// add a hit
+  void add(uint16_t col, uint16_t row);
+
+  /// number of hits
+  unsigned int size() const { return m_cells.size(); }
+
+  /// label hits, return number of clusters
+  unsigned int label(Connectivity connectivity);
+
+  /// cluster id of each hit, in order of addition
+  const std::vector<int> &labels() const { return m_labels; }
+
+ private:
+  struct Cell
+  {
+    uint32_t key = 0;
+    unsigned int index = 0;
+  };
+
+  static uint32_t make_key(uint16_t col, uint16_t row)
+  {
+    return (uint32_t(col) << 16U) | row;
+  }
+
+  /// union-find root, with path halving
+  unsigned int find(unsigned int i);
+
+  /// merge the clusters of hits i and j
+  void merge(unsigned int i, unsigned int j);
+
+  /// merge cell with all sorted cells of given key
+  void merge_with(const Cell &cell, uint32_t key);
+
+  std::vector<Cell> m_cells;
+  std::vector<Cell> m_sorted;
+  std::vector<unsigned int> m_parent;
+  std::vector<int> m_labels;
+};
+
+#endif
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <iterator>
@@ -35,6 +36,247 @@ namespace
   {
     return std::sqrt(square(x) + square(y));
   }
+
+  /**
+   * Taubin circle from the sample means and the normalized moments of the centered points.
+   * Shared by circle_fit_kernel and circle_fit_lanes
+   */
+  TrackFitUtils::circle_fit_output_t circle_fit_solve(const double meanX, const double meanY,
+                                                      const double Mxx, const double Myy, const double Mxy,
+                                                      const double Mxz, const double Myz, const double Mzz)
+  {
+    //  computing coefficients of the characteristic polynomial
+
+    const double Mz = Mxx + Myy;
+    const double Cov_xy = Mxx * Myy - Mxy * Mxy;
+    const double Var_z = Mzz - Mz * Mz;
+    const double A3 = 4 * Mz;
+    const double A2 = -3 * Mz * Mz - Mzz;
+    const double A1 = Var_z * Mz + 4 * Cov_xy * Mz - Mxz * Mxz - Myz * Myz;
+    const double A0 = Mxz * (Mxz * Myy - Myz * Mxy) + Myz * (Myz * Mxx - Mxz * Mxy) - Var_z * Cov_xy;
+    const double A22 = A2 + A2;
+    const double A33 = A3 + A3 + A3;
+
+    //    finding the root of the characteristic polynomial
+    //    using Newton's method starting at x=0
+    //    (it is guaranteed to converge to the right root)
+    static constexpr int iter_max = 99;
+    double x = 0;
+    double y = A0;
+
+    // usually, 4-6 iterations are enough
+    for (int iter = 0; iter < iter_max; ++iter)
+    {
+      const double Dy = A1 + x * (A22 + A33 * x);
+      const double xnew = x - y / Dy;
+      if ((xnew == x) || (!std::isfinite(xnew)))
+      {
+        break;
+      }
+
+      const double ynew = A0 + xnew * (A1 + xnew * (A2 + xnew * A3));
+      if (std::abs(ynew) >= std::abs(y))
+      {
+        break;
+      }
+
+      x = xnew;
+      y = ynew;
+    }
+
+    //  computing parameters of the fitting circle
+    const double DET = square(x) - x * Mz + Cov_xy;
+    const double Xcenter = (Mxz * (Myy - x) - Myz * Mxy) / DET / 2;
+    const double Ycenter = (Myz * (Mxx - x) - Mxz * Mxy) / DET / 2;
+
+    //  assembling the output
+    double const X0 = Xcenter + meanX;
+    double const Y0 = Ycenter + meanY;
+    double const R = std::sqrt(square(Xcenter) + square(Ycenter) + Mz);
+    return std::make_tuple(R, X0, Y0);
+  }
+
+  /**
+   * Taubin circle fit to n points, the coordinates of point i are get_x(i) and get_y(i).
+   * All circle fits use this kernel (or circle_fit_lanes, which adds the points in the
+   * same order), whatever the storage of the points, so that they give bitwise
+   * identical results for the same points
+   */
+  template <class GetX, class GetY>
+  TrackFitUtils::circle_fit_output_t circle_fit_kernel(const std::size_t n, const GetX& get_x, const GetY& get_y)
+  {
+    // Compute x- and y- sample means
+    double meanX = 0;
+    double meanY = 0;
+    double weight = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      meanX += get_x(i);
+      meanY += get_y(i);
+      ++weight;
+    }
+    meanX /= weight;
+    meanY /= weight;
+
+    //     computing moments
+
+    double Mxx = 0;
+    double Myy = 0;
+    double Mxy = 0;
+    double Mxz = 0;
+    double Myz = 0;
+    double Mzz = 0;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      double const Xi = get_x(i) - meanX;  //  centered x-coordinates
+      double const Yi = get_y(i) - meanY;  //  centered y-coordinates
+      double const Zi = square(Xi) + square(Yi);
+
+      Mxy += Xi * Yi;
+      Mxx += Xi * Xi;
+      Myy += Yi * Yi;
+      Mxz += Xi * Zi;
+      Myz += Yi * Zi;
+      Mzz += Zi * Zi;
+    }
+    Mxx /= weight;
+    Myy /= weight;
+    Mxy /= weight;
+    Mxz /= weight;
+    Myz /= weight;
+    Mzz /= weight;
+
+    return circle_fit_solve(meanX, meanY, Mxx, Myy, Mxy, Mxz, Myz, Mzz);
+  }
+
+  /**
+   * Taubin circle fit of all seeds of a batch, one seed per SIMD lane. The seeds are
+   * fitted in blocks of lane_block, the sums of a block stay in registers. Every lane
+   * adds the points of its seed in the same order as circle_fit_kernel and skips the
+   * padding, so the sums are bitwise identical to the ones of the scalar kernel
+   */
+  std::vector<TrackFitUtils::circle_fit_output_t> circle_fit_lanes(const TrackFitUtils::position_batch_t& batch)
+  {
+    static constexpr std::size_t lanes = TrackFitUtils::position_batch_t::lane_block;
+    const std::size_t nseeds = batch.size();
+    const std::size_t stride = batch.stride();
+
+    std::vector<TrackFitUtils::circle_fit_output_t> output;
+    output.reserve(nseeds);
+    for (std::size_t first = 0; first < nseeds; first += lanes)
+    {
+      // lanes beyond the last seed have no points. The number of points is kept as
+      // double (the weight of the scalar fit), double compares vectorize everywhere
+      double weight[lanes] = {};
+      std::size_t npoints = 0;
+      for (std::size_t lane = 0; lane < lanes && first + lane < nseeds; ++lane)
+      {
+        weight[lane] = static_cast<double>(batch.size(first + lane));
+        npoints = std::max(npoints, batch.size(first + lane));
+      }
+
+      // x- and y- sample means, adding the zeros of the padding does not change the sums
+      double meanX[lanes] = {};
+      double meanY[lanes] = {};
+      for (std::size_t ipoint = 0; ipoint < npoints; ++ipoint)
+      {
+        const double* x = batch.x.data() + ipoint * stride + first;
+        const double* y = batch.y.data() + ipoint * stride + first;
+#pragma omp simd
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+          meanX[lane] += x[lane];
+          meanY[lane] += y[lane];
+        }
+      }
+#pragma omp simd
+      for (std::size_t lane = 0; lane < lanes; ++lane)
+      {
+        meanX[lane] /= weight[lane];
+        meanY[lane] /= weight[lane];
+      }
+
+      // moments of the centered points, padding points are centered to zero
+      double Mxx[lanes] = {};
+      double Myy[lanes] = {};
+      double Mxy[lanes] = {};
+      double Mxz[lanes] = {};
+      double Myz[lanes] = {};
+      double Mzz[lanes] = {};
+      for (std::size_t ipoint = 0; ipoint < npoints; ++ipoint)
+      {
+        const double* x = batch.x.data() + ipoint * stride + first;
+        const double* y = batch.y.data() + ipoint * stride + first;
+        const auto point = static_cast<double>(ipoint);
+#pragma omp simd
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+          const bool active = point < weight[lane];
+          const double dx = x[lane] - meanX[lane];
+          const double dy = y[lane] - meanY[lane];
+          const double Xi = active ? dx : 0.;
+          const double Yi = active ? dy : 0.;
+          const double Zi = square(Xi) + square(Yi);
+          Mxy[lane] += Xi * Yi;
+          Mxx[lane] += Xi * Xi;
+          Myy[lane] += Yi * Yi;
+          Mxz[lane] += Xi * Zi;
+          Myz[lane] += Yi * Zi;
+          Mzz[lane] += Zi * Zi;
+        }
+      }
+
+      // the Newton iteration of the root finding runs per seed
+      for (std::size_t lane = 0; lane < lanes && first + lane < nseeds; ++lane)
+      {
+        output.push_back(circle_fit_solve(meanX[lane], meanY[lane],
+                                          Mxx[lane] / weight[lane], Myy[lane] / weight[lane], Mxy[lane] / weight[lane],
+                                          Mxz[lane] / weight[lane], Myz[lane] / weight[lane], Mzz[lane] / weight[lane]));
+      }
+    }
+    return output;
+  }
+
+  /**
+   * Deming line fit to n points, the coordinates of point i are get_x(i) and get_y(i).
+   * Shared by all line fits, see circle_fit_kernel
+   */
+  template <class GetX, class GetY>
+  TrackFitUtils::line_fit_output_t line_fit_kernel(const std::size_t n, const GetX& get_x, const GetY& get_y)
+  {
+    // calculate the best line fit to an array of x and y points,
+    // which minimizing the square of the distances orthogonally
+    // from the points to the line. Assume that the variances of x and y
+    //  are equal (this is the Deming method)
+    // get the mean values
+    double xmean = 0.;
+    double ymean = 0.;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      xmean = xmean + get_x(i);
+      ymean = ymean + get_y(i);
+    }
+    xmean /= static_cast<double>(n);
+    ymean /= static_cast<double>(n);
+
+    // calculate the standard deviations
+    double ssd_x = 0.;
+    double ssd_y = 0.;
+    double ssd_xy = 0.;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const double x = get_x(i);
+      const double y = get_y(i);
+      ssd_x += square(x - xmean);
+      ssd_y += square(y - ymean);
+      ssd_xy += (x - xmean) * (y - ymean);
+    }
+    const double slope = (ssd_y - ssd_x + sqrt(square(ssd_y - ssd_x) + 4 * square(ssd_xy))) / 2. / ssd_xy;
+    const double intercept = ymean - slope * xmean;
+    return std::make_tuple(slope, intercept);
+  }
 }  // namespace
 
 std::pair<Acts::Vector3, Acts::Vector3> TrackFitUtils::get_helix_tangent(const std::vector<float>& fitpars, Acts::Vector3& global)
@@ -128,180 +370,96 @@ Acts::Vector3 TrackFitUtils::surface_3Dline_intersection(const TrkrDefs::cluskey
 //_________________________________________________________________________________
 TrackFitUtils::circle_fit_output_t TrackFitUtils::circle_fit_by_taubin(const TrackFitUtils::position_vector_t& positions)
 {
-  // Compute x- and y- sample means
-  double meanX = 0;
-  double meanY = 0;
-  double weight = 0;
-
-  for (const auto& [x, y] : positions)
-  {
-    meanX += x;
-    meanY += y;
-    ++weight;
-  }
-  meanX /= weight;
-  meanY /= weight;
-
-  //     computing moments
-
-  double Mxx = 0;
-  double Myy = 0;
-  double Mxy = 0;
-  double Mxz = 0;
-  double Myz = 0;
-  double Mzz = 0;
-
-  for (auto& [x, y] : positions)
-  {
-    double const Xi = x - meanX;  //  centered x-coordinates
-    double const Yi = y - meanY;  //  centered y-coordinates
-    double const Zi = square(Xi) + square(Yi);
-
-    Mxy += Xi * Yi;
-    Mxx += Xi * Xi;
-    Myy += Yi * Yi;
-    Mxz += Xi * Zi;
-    Myz += Yi * Zi;
-    Mzz += Zi * Zi;
-  }
-  Mxx /= weight;
-  Myy /= weight;
-  Mxy /= weight;
-  Mxz /= weight;
-  Myz /= weight;
-  Mzz /= weight;
-
-  //  computing coefficients of the characteristic polynomial
-
-  const double Mz = Mxx + Myy;
-  const double Cov_xy = Mxx * Myy - Mxy * Mxy;
-  const double Var_z = Mzz - Mz * Mz;
-  const double A3 = 4 * Mz;
-  const double A2 = -3 * Mz * Mz - Mzz;
-  const double A1 = Var_z * Mz + 4 * Cov_xy * Mz - Mxz * Mxz - Myz * Myz;
-  const double A0 = Mxz * (Mxz * Myy - Myz * Mxy) + Myz * (Myz * Mxx - Mxz * Mxy) - Var_z * Cov_xy;
-  const double A22 = A2 + A2;
-  const double A33 = A3 + A3 + A3;
-
-  //    finding the root of the characteristic polynomial
-  //    using Newton's method starting at x=0
-  //    (it is guaranteed to converge to the right root)
-  static constexpr int iter_max = 99;
-  double x = 0;
-  double y = A0;
-
-  // usually, 4-6 iterations are enough
-  for (int iter = 0; iter < iter_max; ++iter)
-  {
-    const double Dy = A1 + x * (A22 + A33 * x);
-    const double xnew = x - y / Dy;
-    if ((xnew == x) || (!std::isfinite(xnew)))
-    {
-      break;
-    }
-
-    const double ynew = A0 + xnew * (A1 + xnew * (A2 + xnew * A3));
-    if (std::abs(ynew) >= std::abs(y))
-    {
-      break;
-    }
-
-    x = xnew;
-    y = ynew;
-  }
-
-  //  computing parameters of the fitting circle
-  const double DET = square(x) - x * Mz + Cov_xy;
-  const double Xcenter = (Mxz * (Myy - x) - Myz * Mxy) / DET / 2;
-  const double Ycenter = (Myz * (Mxx - x) - Mxz * Mxy) / DET / 2;
-
-  //  assembling the output
-  double const X0 = Xcenter + meanX;
-  double const Y0 = Ycenter + meanY;
-  double const R = std::sqrt(square(Xcenter) + square(Ycenter) + Mz);
-  return std::make_tuple(R, X0, Y0);
+  return circle_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return positions[i].first; },
+      [&positions](std::size_t i)
+      { return positions[i].second; });
 }
 
 //_________________________________________________________________________________
 TrackFitUtils::circle_fit_output_t TrackFitUtils::circle_fit_by_taubin(const std::vector<Acts::Vector3>& positions)
 {
-  position_vector_t positions_2d;
-  for (const auto& position : positions)
-  {
-    positions_2d.emplace_back(position.x(), position.y());
-  }
-
-  return circle_fit_by_taubin(positions_2d);
+  return circle_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return positions[i].x(); },
+      [&positions](std::size_t i)
+      { return positions[i].y(); });
 }
 
 //_________________________________________________________________________________
-TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit(const TrackFitUtils::position_vector_t& positions)
+std::vector<TrackFitUtils::circle_fit_output_t> TrackFitUtils::circle_fit_by_taubin(const TrackFitUtils::position_batch_t& batch)
 {
-  // calculate the best line fit to an array of x and y points,
-  // which minimizing the square of the distances orthogonally
-  // from the points to the line. Assume that the variances of x and y
-  //  are equal (this is the Deming method)
-  // get the mean values
-  double xmean = 0.;
-  double ymean = 0.;
-  for (const auto& [x, y] : positions)
+  // the lanes also process the padding of the shorter seeds, fit one seed after the
+  // other if there are only a few seeds or most of the batch is padding
+  if (batch.size() >= position_batch_t::lane_block / 2 && 2 * batch.total_points >= batch.size() * batch.max_size())
   {
-    xmean = xmean + x;
-    ymean = ymean + y;
+    return circle_fit_lanes(batch);
   }
-  double const n = positions.size();
-  xmean /= n;
-  ymean /= n;
-
-  // calculate the standard deviations
-  double ssd_x = 0.;
-  double ssd_y = 0.;
-  double ssd_xy = 0.;
-  for (const auto& [x, y] : positions)
+
+  std::vector<circle_fit_output_t> output;
+  output.reserve(batch.size());
+  const std::size_t stride = batch.stride();
+  for (std::size_t iseed = 0; iseed < batch.size(); ++iseed)
   {
-    ssd_x += square(x - xmean);
-    ssd_y += square(y - ymean);
-    ssd_xy += (x - xmean) * (y - ymean);
+    const double* x = batch.x.data() + iseed;
+    const double* y = batch.y.data() + iseed;
+    output.push_back(circle_fit_kernel(
+        batch.size(iseed),
+        [x, stride](std::size_t i)
+        { return x[i * stride]; },
+        [y, stride](std::size_t i)
+        { return y[i * stride]; }));
   }
-  const double slope = (ssd_y - ssd_x + sqrt(square(ssd_y - ssd_x) + 4 * square(ssd_xy))) / 2. / ssd_xy;
-  const double intercept = ymean - slope * xmean;
-  return std::make_tuple(slope, intercept);
+  return output;
 }
 
 //_________________________________________________________________________________
-TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit(const std::vector<Acts::Vector3>& positions)
+TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit(const TrackFitUtils::position_vector_t& positions)
 {
-  position_vector_t positions_2d;
-  for (const auto& position : positions)
-  {
-    positions_2d.emplace_back(std::sqrt(square(position.x()) + square(position.y())), position.z());
-  }
+  return line_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return positions[i].first; },
+      [&positions](std::size_t i)
+      { return positions[i].second; });
+}
 
-  return line_fit(positions_2d);
+//_________________________________________________________________________________
+TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit(const std::vector<Acts::Vector3>& positions)
+{
+  return line_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return std::sqrt(square(positions[i].x()) + square(positions[i].y())); },
+      [&positions](std::size_t i)
+      { return positions[i].z(); });
 }
 
 //_________________________________________________________________________________
 TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit_xz(const std::vector<Acts::Vector3>& positions)
 {
-  position_vector_t positions_2d;
-  for (const auto& position : positions)
-  {
-    positions_2d.emplace_back(position.x(), position.z());  // returns dx/dz and z intercept
-  }
-
-  return line_fit(positions_2d);
+  // returns dx/dz and z intercept
+  return line_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return positions[i].x(); },
+      [&positions](std::size_t i)
+      { return positions[i].z(); });
 }
 
 //_________________________________________________________________________________
 TrackFitUtils::line_fit_output_t TrackFitUtils::line_fit_xy(const std::vector<Acts::Vector3>& positions)
 {
-  position_vector_t positions_2d;
-  for (const auto& position : positions)
-  {
-    positions_2d.emplace_back(position.x(), position.y());  // returns dx/dy and y intercept
-  }
-
-  return line_fit(positions_2d);
+  // returns dx/dy and y intercept
+  return line_fit_kernel(
+      positions.size(),
+      [&positions](std::size_t i)
+      { return positions[i].x(); },
+      [&positions](std::size_t i)
+      { return positions[i].y(); });
 }
 
 //_________________________________________________________________________________
@@ -7,6 +7,7 @@
 
 #include <Acts/Definitions/Algebra.hpp>
 
+#include <cstddef>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -39,6 +40,65 @@ namespace TrackFitUtils
   /// convenient overload
   circle_fit_output_t circle_fit_by_taubin(const std::vector<Acts::Vector3>&);
 
+  /**
+   * 2D positions of many seeds for the batched fits, point major across seeds:
+   * point i of seed s is x[i * stride() + s]. The seeds are padded (with zeros) to
+   * max_size() points and to a multiple of lane_block seeds, counts[s] is the
+   * number of points of seed s.
+   * reset() sizes the batch for an event and keeps the memory for the next one
+   */
+  struct position_batch_t
+  {
+    /// seeds fitted together by the SIMD kernel
+    static constexpr std::size_t lane_block = 8;
+
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<std::size_t> counts;
+    std::size_t padded_seeds{0};
+    std::size_t max_points{0};
+    std::size_t total_points{0};
+
+    /// empty batch of nseeds seeds with up to maxpoints points each
+    void reset(std::size_t nseeds, std::size_t maxpoints)
+    {
+      padded_seeds = (nseeds + lane_block - 1) / lane_block * lane_block;
+      max_points = maxpoints;
+      total_points = 0;
+      counts.assign(nseeds, 0);
+      x.assign(padded_seeds * maxpoints, 0);
+      y.assign(padded_seeds * maxpoints, 0);
+    }
+
+    /// add a point to seed iseed, at most max_size() points per seed
+    void add(std::size_t iseed, double xi, double yi)
+    {
+      const std::size_t index = counts[iseed]++ * padded_seeds + iseed;
+      x[index] = xi;
+      y[index] = yi;
+      ++total_points;
+    }
+
+    /// number of seeds
+    std::size_t size() const { return counts.size(); }
+
+    /// number of points of seed i
+    std::size_t size(std::size_t i) const { return counts[i]; }
+
+    /// number of points of the longest seed
+    std::size_t max_size() const { return max_points; }
+
+    /// distance between consecutive points of a seed in x and y
+    std::size_t stride() const { return padded_seeds; }
+  };
+
+  /**
+   * circle fit of each seed of the batch, one seed per SIMD lane. Bitwise identical
+   * to circle_fit_by_taubin of its points (TrackFitUtils.cc is compiled with
+   * -ffp-contract=off). Few seeds or mostly padding are fitted one seed after the other
+   */
+  std::vector<circle_fit_output_t> circle_fit_by_taubin(const position_batch_t&);
+
   /// line fit output [slope, intercept]
   using line_fit_output_t = std::tuple<double, double>;
 
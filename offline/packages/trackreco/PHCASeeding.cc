@@ -889,6 +889,9 @@ std::vector<TrackSeed_v2> PHCASeeding::RemoveBadClusters(const std::vector<PHCAS
   }
   std::vector<TrackSeed_v2> clean_chains;
 
+  // fit a circle through the x,y coordinates of all chains at once
+  std::vector<const keyList*> fitted_chains;
+  std::size_t max_chain_size = 0;
   for (const auto& chain : chains)
   {
     if (chain.size() < 3)
@@ -899,29 +902,34 @@ std::vector<TrackSeed_v2> PHCASeeding::RemoveBadClusters(const std::vector<PHCAS
     {
       std::cout << "chain size: " << chain.size() << std::endl;
     }
+    fitted_chains.push_back(&chain);
+    max_chain_size = std::max(max_chain_size, chain.size());
+  }
 
-    TrackFitUtils::position_vector_t xy_pts;
-    for (const auto& cluskey : chain)
+  TrackFitUtils::position_batch_t xy_pts;
+  xy_pts.reset(fitted_chains.size(), max_chain_size);
+  for (std::size_t ichain = 0; ichain < fitted_chains.size(); ++ichain)
+  {
+    for (const auto& cluskey : *fitted_chains[ichain])
     {
       const auto& global = globalPositions.at(cluskey);
-      xy_pts.emplace_back(global.x(), global.y());
+      xy_pts.add(ichain, global.x(), global.y());
     }
+  }
 
-    // fit a circle through x,y coordinates
-    const auto [R, X0, Y0] = TrackFitUtils::circle_fit_by_taubin(xy_pts);
-
+  const auto circle_fits = TrackFitUtils::circle_fit_by_taubin(xy_pts);
+  for (std::size_t ichain = 0; ichain < fitted_chains.size(); ++ichain)
+  {
     // skip chain entirely if fit fails
+    const auto R = std::get<0>(circle_fits[ichain]);
     if (std::isnan(R))
     {
       continue;
     }
 
-    // calculate residuals
-    const std::vector<double> xy_resid = TrackFitUtils::getCircleClusterResiduals(xy_pts, R, X0, Y0);
-
     // assign clusters to seed
     TrackSeed_v2 trackseed;
-    for (const auto& key : chain)
+    for (const auto& key : *fitted_chains[ichain])
     {
       trackseed.insert_cluster_key(key);
     }
@@ -198,7 +198,10 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
 
   // list of cluster chains
   std::vector<std::vector<TrkrDefs::cluskey>> new_chains;
-  std::vector<TrackSeed_v2> unused_tracks;
+
+  // non TPC seeds, with their index in the input map, so that they are
+  // published in input order whatever the thread layout
+  std::vector<std::pair<size_t, TrackSeed_v2>> unused_tracks;
 
   timer.restart();
   #pragma omp parallel
@@ -215,7 +218,7 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
     PHTimer timer_mp("KFPropTimer_parallel");
 
     std::vector<std::vector<TrkrDefs::cluskey>> local_chains;
-    std::vector<TrackSeed_v2> local_unused;
+    std::vector<std::pair<size_t, TrackSeed_v2>> local_unused;
 
     #pragma omp for schedule(static)
     for (size_t track_it = 0; track_it != _track_map->size(); ++track_it)
@@ -247,7 +250,7 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
         // copy seed clusters position into local map
         std::map<TrkrDefs::cluskey, Acts::Vector3> trackClusPositions;
         std::transform(track->begin_cluster_keys(), track->end_cluster_keys(), std::inserter(trackClusPositions, trackClusPositions.end()),
-          [globalPositions](const auto& key)
+          [&globalPositions](const auto& key)
         { return std::make_pair(key, globalPositions.at(key)); });
 
         /// Can't circle fit a seed with less than 3 clusters, skip it
@@ -322,7 +325,7 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
         // copy seed clusters position into local map
         std::map<TrkrDefs::cluskey, Acts::Vector3> pretrackClusPositions;
         std::transform(pretrack.begin_cluster_keys(), pretrack.end_cluster_keys(), std::inserter(pretrackClusPositions, pretrackClusPositions.end()),
-          [globalPositions](const auto& key)
+          [&globalPositions](const auto& key)
           { return std::make_pair(key, globalPositions.at(key)); });
 
         // fit seed
@@ -353,7 +356,7 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
         {
           std::cout << "is NOT tpc track" << std::endl;
         }
-        local_unused.emplace_back(*track);
+        local_unused.emplace_back(track_it, *track);
       }
     }
 
@@ -424,7 +427,12 @@ int PHSimpleKFProp::process_event(PHCompositeNode* topNode)
   }
 
   // also publish unused seeds (not TPC)
-  publishSeeds(unused_tracks);
+  std::sort(unused_tracks.begin(), unused_tracks.end(),
+    [](const auto& first, const auto& second) { return first.first < second.first; });
+  for (const auto& [index, seed] : unused_tracks)
+  {
+    _track_map->insert(&seed);
+  }
 
   if (Verbosity())
   { std::cout << "PHSimpleKFProp::process_event - publishSeeds time: " << timer.elapsed() << " ms" << std::endl; }
@@ -487,11 +495,15 @@ PositionMap PHSimpleKFProp::PrepareKDTrees()
   }
   _ptclouds.resize(kdhits.size());
   _kdtrees.resize(kdhits.size());
+
+  // layers are independent, build their trees in parallel
+  // layer occupancies differ a lot, hence the dynamic schedule
+  #pragma omp parallel for schedule(dynamic)
   for (size_t l = 0; l < kdhits.size(); ++l)
   {
     if (Verbosity() > 1)
     {
-      std::cout << "l: " << l << std::endl;
+      std::osyncstream(std::cout) << "l: " << l << std::endl;
     }
     _ptclouds[l] = std::make_shared<KDPointCloud<double>>();
     _ptclouds[l]->pts = std::move(kdhits[l]);
@@ -897,9 +909,9 @@ bool PHSimpleKFProp::PropagateStep(
 
   // search for closest available cluster within window
   double query_pt[3] = {new_tx, new_ty, new_tz};
-  std::vector<long unsigned int> index_out(1);
-  std::vector<double> distance_out(1);
-  int n_results = _kdtrees[next_layer]->knnSearch(&query_pt[0], 1, &index_out[0], &distance_out[0]);
+  long unsigned int index_out = 0;
+  double distance_out = 0;
+  int n_results = _kdtrees[next_layer]->knnSearch(&query_pt[0], 1, &index_out, &distance_out);
 
   // if no results, then no cluster to add, but propagation is not necessarily done
   if (!n_results)
@@ -911,7 +923,7 @@ bool PHSimpleKFProp::PropagateStep(
     current_layer = next_layer;
     return true;
   }
-  const std::vector<double>& point = _ptclouds[next_layer]->pts[index_out[0]];
+  const std::vector<double>& point = _ptclouds[next_layer]->pts[index_out];
   TrkrDefs::cluskey closest_ckey = (*((int64_t*) &point[3]));
   TrkrCluster* clusterCandidate = _cluster_map->findCluster(closest_ckey);
   const auto candidate_globalpos = globalPositions.at(closest_ckey);
@@ -1376,7 +1388,7 @@ void PHSimpleKFProp::rejectAndPublishSeeds(std::vector<TrackSeed_v2>& seeds, con
 
       PositionMap local;
       std::transform(seed.begin_cluster_keys(), seed.end_cluster_keys(), std::inserter(local, local.end()),
-        [positions](const auto& key)
+        [&positions](const auto& key)
         { return std::make_pair(key, positions.at(key)); });
       TrackSeedHelper::circleFitByTaubin(&seed,local, 7, 55);
       TrackSeedHelper::lineFit(&seed,local, 7, 55);
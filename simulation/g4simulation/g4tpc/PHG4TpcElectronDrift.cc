@@ -59,6 +59,7 @@
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>  // for gsl_rng_alloc
 
+#include <algorithm>  // for min
 #include <array>
 #include <cassert>
 #include <cmath>    // for sqrt, abs, NAN
@@ -405,7 +406,8 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
   }
 
   PHG4TpcGeom *layergeom = seggeo->GetLayerCellGeom(20);
-    
+  const double drift_velocity = layergeom->get_drift_velocity_sim();
+
   if (truth_clusterer.needs_input_nodes())
   {
     truth_clusterer.set_input_nodes(truthclustercontainer, m_tGeometry,
@@ -548,13 +550,21 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
 
     int notReachingReadout = 0;
     //    int notInAcceptance = 0;
+    m_electrons.clear();
     for (unsigned int i = 0; i < n_electrons; i++)
     {
+      // random variates are drawn in blocks of m_random_block_size electrons
+      const unsigned int iblock = i % m_random_block_size;
+      if (iblock == 0)
+      {
+        fill_random_block(std::min(m_random_block_size, n_electrons - i));
+      }
+
       // We choose the electron starting position at random from a flat
       // distribution along the path length the parameter t is the fraction of
       // the distance along the path betwen entry and exit points, it has
       // values between 0 and 1
-      const double f = gsl_ran_flat(RandomGenerator.get(), 0.0, 1.0);
+      const double f = m_random_flat[iblock];
 
       const double x_start = hiter->second->get_x(0) + f * (hiter->second->get_x(1) - hiter->second->get_x(0));
       const double y_start = hiter->second->get_y(0) + f * (hiter->second->get_y(1) - hiter->second->get_y(0));
@@ -569,14 +579,14 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
 
       const double r_sigma = diffusion_trans * sqrt(tpc_length / 2. - std::abs(z_start));
       const double rantrans =
-          gsl_ran_gaussian(RandomGenerator.get(), r_sigma) +
-          gsl_ran_gaussian(RandomGenerator.get(), added_smear_sigma_trans);
+          r_sigma * m_random_gaus_trans[iblock] +
+          added_smear_sigma_trans * m_random_smear_trans[iblock];
 
-      const double t_path = (tpc_length / 2. - std::abs(z_start)) / layergeom->get_drift_velocity_sim();
-      const double t_sigma = diffusion_long * sqrt(tpc_length / 2. - std::abs(z_start)) / layergeom->get_drift_velocity_sim();
+      const double t_path = (tpc_length / 2. - std::abs(z_start)) / drift_velocity;
+      const double t_sigma = diffusion_long * sqrt(tpc_length / 2. - std::abs(z_start)) / drift_velocity;
       const double rantime =
-          gsl_ran_gaussian(RandomGenerator.get(), t_sigma) +
-	gsl_ran_gaussian(RandomGenerator.get(), added_smear_sigma_long) / layergeom->get_drift_velocity_sim();
+          t_sigma * m_random_gaus_long[iblock] +
+          added_smear_sigma_long * m_random_smear_long[iblock] / drift_velocity;
       double t_final = t_start + t_path + rantime;
 
       if (t_final < min_time || t_final > max_time)
@@ -587,16 +597,16 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
       double z_final;
       if (z_start < 0)
       {
-        z_final = -tpc_length / 2. + t_final * layergeom->get_drift_velocity_sim();
+        z_final = -tpc_length / 2. + t_final * drift_velocity;
       }
       else
       {
-        z_final = tpc_length / 2. - t_final * layergeom->get_drift_velocity_sim();
+        z_final = tpc_length / 2. - t_final * drift_velocity;
       }
 
       const double radstart = std::sqrt(square(x_start) + square(y_start));
       const double phistart = std::atan2(y_start, x_start);
-      const double ranphi = gsl_ran_flat(RandomGenerator.get(), -M_PI, M_PI);
+      const double ranphi = m_random_phi[iblock];
 
       double x_final = x_start + rantrans * std::cos(ranphi);  // Initialize these to be only diffused first, will be overwritten if doing SC distortion
       double y_final = y_start + rantrans * std::sin(ranphi);
@@ -630,11 +640,11 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
         z_final += z_distortion;
         if (z_start < 0)
         {
-          t_final = (z_final + tpc_length / 2.0) / layergeom->get_drift_velocity_sim();
+          t_final = (z_final + tpc_length / 2.0) / drift_velocity;
         }
         else
         {
-          t_final = (tpc_length / 2.0 - z_final) / layergeom->get_drift_velocity_sim();
+          t_final = (tpc_length / 2.0 - z_final) / drift_velocity;
         }
 
         x_final = rad_final * std::cos(phi_final);
@@ -694,11 +704,13 @@ int PHG4TpcElectronDrift::process_event(PHCompositeNode *topNode)
         assert(nt);
         nt->Fill(ihit, t_start, t_final, t_sigma, rad_final, z_start, z_final);
       }
-      padplane->MapToPadPlane(truth_clusterer, single_hitsetcontainer.get(),
-                              temp_hitsetcontainer.get(), hittruthassoc, x_final, y_final, t_final,
-                              side, hiter, ntpad, nthit);
+      m_electrons.push_back(x_final, y_final, t_final, side);
     }  // end loop over electrons for this g4hit
 
+    padplane->MapToPadPlane(truth_clusterer, single_hitsetcontainer.get(),
+                            temp_hitsetcontainer.get(), hittruthassoc, m_electrons,
+                            hiter, ntpad, nthit);
+
     if (do_ElectronDriftQAHistos)
     {
       ratioElectronsRR->Fill((double) (n_electrons - notReachingReadout) / n_electrons);
@@ -925,6 +937,45 @@ int PHG4TpcElectronDrift::End(PHCompositeNode * /*topNode*/)
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
+void PHG4TpcElectronDrift::fill_random_block(const unsigned int n)
+{
+  // unit variates are scaled per electron, so one pass per distribution
+  // keeps the generator in a tight loop.
+  gsl_rng *rng = RandomGenerator.get();
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    m_random_flat[i] = gsl_rng_uniform(rng);
+  }
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    m_random_gaus_trans[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+  }
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    m_random_gaus_long[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+  }
+  for (unsigned int i = 0; i < n; ++i)
+  {
+    m_random_phi[i] = gsl_ran_flat(rng, -M_PI, M_PI);
+  }
+
+  // the additional smearing is off by default, do not spend random numbers on it
+  if (added_smear_sigma_trans != 0)
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      m_random_smear_trans[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+    }
+  }
+  if (added_smear_sigma_long != 0)
+  {
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      m_random_smear_long[i] = gsl_ran_gaussian_ziggurat(rng, 1.0);
+    }
+  }
+}
+
 void PHG4TpcElectronDrift::set_seed(const unsigned int seed)
 {
   gsl_rng_set(RandomGenerator.get(), seed);
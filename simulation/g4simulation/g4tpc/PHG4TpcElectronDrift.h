@@ -3,6 +3,7 @@
 #ifndef G4TPC_PHG4TPCELECTRONDRIFT_H
 #define G4TPC_PHG4TPCELECTRONDRIFT_H
 
+#include "PHG4TpcPadPlane.h"
 #include "TpcClusterBuilder.h"
 
 #include <trackbase/ActsGeometry.h>
@@ -21,8 +22,8 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
-class PHG4TpcPadPlane;
 class PHG4TpcDistortion;
 class PHCompositeNode;
 class TH1;
@@ -86,6 +87,9 @@ class PHG4TpcElectronDrift : public SubsysReco, public PHParameterInterface
   ClusHitsVerbosev1 *mClusHitsVerbose{nullptr};
 
  private:
+  //! draw the random variates for the next n (<= m_random_block_size) electrons
+  void fill_random_block(const unsigned int n);
+
   TrkrHitSetContainer *hitsetcontainer{nullptr};
   TrkrHitTruthAssoc *hittruthassoc{nullptr};
   TrkrTruthTrackContainer *truthtracks{nullptr};
@@ -143,6 +147,20 @@ class PHG4TpcElectronDrift : public SubsysReco, public PHParameterInterface
   bool zero_bfield{false};
   bool m_use_PDG_gas_params{false};
 
+  ///@name per-electron random variates, drawn in blocks and reused across g4hits
+  //@{
+  static constexpr unsigned int m_random_block_size = 1024;
+  std::vector<double> m_random_flat = std::vector<double>(m_random_block_size, 0);
+  std::vector<double> m_random_phi = std::vector<double>(m_random_block_size, 0);
+  std::vector<double> m_random_gaus_trans = std::vector<double>(m_random_block_size, 0);
+  std::vector<double> m_random_gaus_long = std::vector<double>(m_random_block_size, 0);
+  std::vector<double> m_random_smear_trans = std::vector<double>(m_random_block_size, 0);
+  std::vector<double> m_random_smear_long = std::vector<double>(m_random_block_size, 0);
+  //@}
+
+  //! electrons of the current g4hit that reached the readout plane
+  PHG4TpcPadPlane::ElectronBatch m_electrons;
+
   std::unique_ptr<TrkrHitSetContainer> temp_hitsetcontainer;
   std::unique_ptr<TrkrHitSetContainer> single_hitsetcontainer;
   std::unique_ptr<PHG4TpcPadPlane> padplane;
@@ -9,6 +9,7 @@
 #include <phparameter/PHParameterInterface.h>
 
 #include <string>  // for string
+#include <vector>
 
 class TrkrHitSetContainer;
 class TrkrHitTruthAssoc;
@@ -19,6 +20,33 @@ class TNtuple;
 class PHG4TpcPadPlane : public SubsysReco, public PHParameterInterface
 {
  public:
+  //! electrons from one g4hit arriving at the gem stack, stored as parallel arrays
+  struct ElectronBatch
+  {
+    std::vector<double> x_gem;
+    std::vector<double> y_gem;
+    std::vector<double> t_gem;
+    std::vector<unsigned int> side;
+
+    void clear()
+    {
+      x_gem.clear();
+      y_gem.clear();
+      t_gem.clear();
+      side.clear();
+    }
+
+    void push_back(const double x, const double y, const double t, const unsigned int s)
+    {
+      x_gem.push_back(x);
+      y_gem.push_back(y);
+      t_gem.push_back(t);
+      side.push_back(s);
+    }
+
+    std::size_t size() const { return x_gem.size(); }
+  };
+
   PHG4TpcPadPlane(const std::string &name = "PHG4TpcPadPlane");
 
   int process_event(PHCompositeNode *) final
@@ -32,6 +60,14 @@ class PHG4TpcPadPlane : public SubsysReco, public PHParameterInterface
   virtual void UpdateInternalParameters() { return; }
   //  virtual void MapToPadPlane(PHG4CellContainer * /*g4cells*/, const double /*x_gem*/, const double /*y_gem*/, const double /*t_gem*/, const unsigned int /*side*/, PHG4HitContainer::ConstIterator /*hiter*/, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) {}
   virtual void MapToPadPlane(TpcClusterBuilder & /*builder*/, TrkrHitSetContainer * /*single_hitsetcontainer*/, TrkrHitSetContainer * /*hitsetcontainer*/, TrkrHitTruthAssoc * /*hittruthassoc*/, const double /*x_gem*/, const double /*y_gem*/, const double /*t_gem*/, const unsigned int /*side*/, PHG4HitContainer::ConstIterator /*hiter*/, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) = 0;  // { return {}; }
+  //! map all electrons of a g4hit at once. Default implementation maps them one by one
+  virtual void MapToPadPlane(TpcClusterBuilder &builder, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc *hittruthassoc, const ElectronBatch &electrons, PHG4HitContainer::ConstIterator hiter, TNtuple *ntpad, TNtuple *nthit)
+  {
+    for (std::size_t i = 0; i < electrons.size(); ++i)
+    {
+      MapToPadPlane(builder, single_hitsetcontainer, hitsetcontainer, hittruthassoc, electrons.x_gem[i], electrons.y_gem[i], electrons.t_gem[i], electrons.side[i], hiter, ntpad, nthit);
+    }
+  }
   void Detector(const std::string &name) { detector = name; }
 
  protected:
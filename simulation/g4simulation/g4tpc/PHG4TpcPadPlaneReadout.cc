@@ -37,12 +37,15 @@
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_rng.h>  // for gsl_rng_alloc
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>  // for getenv
 #include <format>
 #include <iostream>
-#include <map>      // for _Rb_tree_cons...
-#include <utility>  // for pair
+#include <iterator>  // for prev
+#include <map>       // for _Rb_tree_cons...
+#include <tuple>     // for tie
+#include <utility>   // for pair
 
 class PHCompositeNode;
 class TrkrHitTruthAssoc;
@@ -118,6 +121,22 @@ int PHG4TpcPadPlaneReadout::InitRun(PHCompositeNode *topNode)
   const double MinT = 0;
   NTBins = (int) ((MaxT - MinT) / TBinWidth) + 1;
 
+  buildSampaKernel(layergeom->get_zstep());
+
+  // radial boundaries of the readout layers, ordered in radius
+  m_layer_bounds.clear();
+  PHG4TpcGeomContainer::ConstRange layerrange = GeomContainer->get_begin_end();
+  for (auto layeriter = layerrange.first; layeriter != layerrange.second; ++layeriter)
+  {
+    const double rad_low = layeriter->second->get_radius() - layeriter->second->get_thickness() / 2.0;
+    const double rad_high = layeriter->second->get_radius() + layeriter->second->get_thickness() / 2.0;
+    m_layer_bounds.push_back({rad_low, rad_high, layeriter->second});
+  }
+  std::sort(m_layer_bounds.begin(), m_layer_bounds.end(),
+            [](const LayerBounds &lhs, const LayerBounds &rhs)
+            { return lhs.rad_low < rhs.rad_low; });
+  m_sector_phi_geom = nullptr;
+
   if (m_use_module_gain_weights)
   {
     int side;
@@ -302,6 +321,31 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
     TrkrHitTruthAssoc * /*hittruthassoc*/,
     const double x_gem, const double y_gem, const double t_gem, const unsigned int side,
     PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/)
+{
+  m_charge_buffer.clear();
+  depositElectron(x_gem, y_gem, t_gem, side, hiter);
+  flushChargeBuffer(tpc_truth_clusterer, single_hitsetcontainer, hitsetcontainer);
+}
+
+void PHG4TpcPadPlaneReadout::MapToPadPlane(
+    TpcClusterBuilder &tpc_truth_clusterer,
+    TrkrHitSetContainer *single_hitsetcontainer,
+    TrkrHitSetContainer *hitsetcontainer,
+    TrkrHitTruthAssoc * /*hittruthassoc*/,
+    const ElectronBatch &electrons,
+    PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/)
+{
+  // all electrons of a g4hit are accumulated first, so every pad/time bin
+  // they touch is looked up in the hitset containers only once
+  m_charge_buffer.clear();
+  for (std::size_t i = 0; i < electrons.size(); ++i)
+  {
+    depositElectron(electrons.x_gem[i], electrons.y_gem[i], electrons.t_gem[i], electrons.side[i], hiter);
+  }
+  flushChargeBuffer(tpc_truth_clusterer, single_hitsetcontainer, hitsetcontainer);
+}
+
+void PHG4TpcPadPlaneReadout::depositElectron(const double x_gem, const double y_gem, const double t_gem, const unsigned int side, PHG4HitContainer::ConstIterator hiter)
 {
   // One electron per call of this method
   // The x_gem and y_gem values have already been randomized within the transverse drift diffusion width
@@ -348,30 +392,26 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   /* TpcClusterBuilder pass_data {}; */
 
   // Find which readout layer this electron ends up in
-
-  PHG4TpcGeomContainer::ConstRange layerrange = GeomContainer->get_begin_end();
-  for (PHG4TpcGeomContainer::ConstIterator layeriter = layerrange.first;
-       layeriter != layerrange.second;
-       ++layeriter)
+  // layers do not overlap, so take the last one starting below rad_gem
+  auto layeriter = std::upper_bound(m_layer_bounds.begin(), m_layer_bounds.end(), rad_gem,
+                                    [](const double rad, const LayerBounds &bounds)
+                                    { return rad <= bounds.rad_low; });
+  if (layeriter != m_layer_bounds.begin() && rad_gem < std::prev(layeriter)->rad_high)
   {
-    double rad_low = layeriter->second->get_radius() - layeriter->second->get_thickness() / 2.0;
-    double rad_high = layeriter->second->get_radius() + layeriter->second->get_thickness() / 2.0;
+    const auto &bounds = *std::prev(layeriter);
 
-    if (rad_gem > rad_low && rad_gem < rad_high)
-    {
-      // capture the layer where this electron hits the gem stack
-      LayerGeom = layeriter->second;
+    // capture the layer where this electron hits the gem stack
+    LayerGeom = bounds.geom;
 
-      layernum = LayerGeom->get_layer();
-      /* pass_data.layerGeom = LayerGeom; */
-      /* pass_data.layer = layernum; */
-      if (Verbosity() > 1000)
-      {
-        std::cout << " g4hit id " << hiter->first << " rad_gem " << rad_gem << " rad_low " << rad_low << " rad_high " << rad_high
-                  << " layer  " << hiter->second->get_layer() << " want to change to " << layernum << std::endl;
-      }
-      hiter->second->set_layer(layernum);  // have to set here, since the stepping action knows nothing about layers
+    layernum = LayerGeom->get_layer();
+    /* pass_data.layerGeom = LayerGeom; */
+    /* pass_data.layer = layernum; */
+    if (Verbosity() > 1000)
+    {
+      std::cout << " g4hit id " << hiter->first << " rad_gem " << rad_gem << " rad_low " << bounds.rad_low << " rad_high " << bounds.rad_high
+                << " layer  " << hiter->second->get_layer() << " want to change to " << layernum << std::endl;
     }
+    hiter->second->set_layer(layernum);  // have to set here, since the stepping action knows nothing about layers
   }
 
   if (layernum == 0)
@@ -385,9 +425,14 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
 
   const auto tbins = LayerGeom->get_zbins();
 
-  sector_min_Phi = LayerGeom->get_sector_min_phi();
-  sector_max_Phi = LayerGeom->get_sector_max_phi();
-  phi_bin_width = LayerGeom->get_phistep();
+  // consecutive electrons mostly land in the same layer, only copy the sector boundaries on change
+  if (LayerGeom != m_sector_phi_geom)
+  {
+    sector_min_Phi = LayerGeom->get_sector_min_phi();
+    sector_max_Phi = LayerGeom->get_sector_max_phi();
+    phi_bin_width = LayerGeom->get_phistep();
+    m_sector_phi_geom = LayerGeom;
+  }
 
   phi = check_phi(side, phi, rad_gem);
 
@@ -497,8 +542,10 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
               << std::endl;
   }
 
-  std::vector<int> pad_phibin;
-  std::vector<double> pad_phibin_share;
+  auto &pad_phibin = m_pad_phibin;
+  auto &pad_phibin_share = m_pad_phibin_share;
+  pad_phibin.clear();
+  pad_phibin_share.clear();
 
   populate_zigzag_phibins(side, layernum, phi, sigmaT, pad_phibin, pad_phibin_share);
   /* if (pad_phibin.size() == 0) { */
@@ -527,8 +574,10 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
 		<< " with t_gem " << t_gem << " SAMPA peaking time  " << Ts << std::endl;
     }
 
-  std::vector<int> adc_tbin;
-  std::vector<double> adc_tbin_share;
+  auto &adc_tbin = m_adc_tbin;
+  auto &adc_tbin_share = m_adc_tbin_share;
+  adc_tbin.clear();
+  adc_tbin_share.clear();
   sampaTimeDistribution(t_gem, adc_tbin, adc_tbin_share);
 
   /* if (adc_tbin.size() == 0)  { */
@@ -607,79 +656,17 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
                   << " neffelectrons " << neffelectrons << " neffelectrons_threshold " << neffelectrons_threshold << std::endl;
       }
 
-      // new containers
-      //============
-      // We add the Tpc TrkrHitsets directly to the node using hitsetcontainer
-      // We need to create the TrkrHitSet if not already made - each TrkrHitSet should correspond to a Tpc readout module
-      // The hitset key includes the layer, sector, side
-
-      // The side is an input parameter
-
       // get the Tpc readout sector - there are 12 sectors with how many pads each?
+      // The hitset key includes the layer, sector, side. The side is an input parameter
       unsigned int pads_per_sector = phibins / 12;
       unsigned int sector = pad_num / pads_per_sector;
       TrkrDefs::hitsetkey hitsetkey = TpcDefs::genHitSetKey(layernum, sector, side);
-      // Use existing hitset or add new one if needed
-      TrkrHitSetContainer::Iterator hitsetit = hitsetcontainer->findOrAddHitSet(hitsetkey);
-      TrkrHitSetContainer::Iterator single_hitsetit = single_hitsetcontainer->findOrAddHitSet(hitsetkey);
-      TrkrDefs::hitkey hitkey;
 
-      if (m_maskDeadChannels)
-      {
-        hitkey = TpcDefs::genHitKey((unsigned int) pad_num, 0);
-        if (m_deadChannelMap.contains(hitsetkey) &&
-            std::find(m_deadChannelMap[hitsetkey].begin(), m_deadChannelMap[hitsetkey].end(), hitkey) != m_deadChannelMap[hitsetkey].end())
-        {
-          continue;
-        }
-      }
-      if (m_maskHotChannels)
-      {
-        hitkey = TpcDefs::genHitKey((unsigned int) pad_num, 0);
-        if (m_hotChannelMap.contains(hitsetkey) &&
-            std::find(m_hotChannelMap[hitsetkey].begin(), m_hotChannelMap[hitsetkey].end(), hitkey) != m_hotChannelMap[hitsetkey].end())
-        {
-          continue;
-        }
-      }
       // generate the key for this hit, requires tbin and phibin
-      hitkey = TpcDefs::genHitKey((unsigned int) pad_num, (unsigned int) tbin_num);
-
-      // See if this hit already exists
-      TrkrHit *hit = nullptr;
-      hit = hitsetit->second->getHit(hitkey);
-      if (!hit)
-      {
-        // create a new one
-        hit = new TrkrHitv2();
-        hitsetit->second->addHitSpecificKey(hitkey, hit);
-      }
-      // Either way, add the energy to it  -- adc values will be added at digitization
-      hit->addEnergy(neffelectrons);
-
-      tpc_truth_clusterer.addhitset(hitsetkey, hitkey, neffelectrons);
-
-      // repeat for the single_hitsetcontainer
-      // See if this hit already exists
-      TrkrHit *single_hit = nullptr;
-      single_hit = single_hitsetit->second->getHit(hitkey);
-      if (!single_hit)
-      {
-        // create a new one
-        single_hit = new TrkrHitv2();
-        single_hitsetit->second->addHitSpecificKey(hitkey, single_hit);
-      }
-      // Either way, add the energy to it  -- adc values will be added at digitization
-      single_hit->addEnergy(neffelectrons);
-
-      /*
-      if (Verbosity() > 0)
-      {
-        assert(nthit);
-        nthit->Fill(layernum, pad_num, tbin_num, neffelectrons);
-      }
-      */
+      TrkrDefs::hitkey hitkey = TpcDefs::genHitKey((unsigned int) pad_num, (unsigned int) tbin_num);
 
+      // the charge is added to the hitsets in flushChargeBuffer
+      m_charge_buffer.push_back({hitsetkey, hitkey, neffelectrons});
     }  // end of loop over adc T bins
   }  // end of loop over zigzag pads
   /* pass_data.phi_integral = phi_integral; */
@@ -715,6 +702,82 @@ void PHG4TpcPadPlaneReadout::MapToPadPlane(
   m_NHits++;
   /* return pass_data; */
 }
+
+void PHG4TpcPadPlaneReadout::flushChargeBuffer(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer)
+{
+  // order by hitset, then hit, so that contributions to the same pad and time bin are adjacent
+  std::sort(m_charge_buffer.begin(), m_charge_buffer.end(),
+            [](const ChargeDeposit &lhs, const ChargeDeposit &rhs)
+            { return std::tie(lhs.hitsetkey, lhs.hitkey) < std::tie(rhs.hitsetkey, rhs.hitkey); });
+
+  TrkrHitSetContainer::Iterator hitsetit;
+  TrkrHitSetContainer::Iterator single_hitsetit;
+  TrkrDefs::hitsetkey current_hitsetkey = TrkrDefs::HITSETKEYMAX;
+  const std::vector<TrkrDefs::hitkey> *dead_channels = nullptr;
+  const std::vector<TrkrDefs::hitkey> *hot_channels = nullptr;
+
+  for (auto deposit = m_charge_buffer.begin(); deposit != m_charge_buffer.end();)
+  {
+    const TrkrDefs::hitsetkey hitsetkey = deposit->hitsetkey;
+    const TrkrDefs::hitkey hitkey = deposit->hitkey;
+
+    // sum all contributions to this hit
+    double neffelectrons = 0;
+    for (; deposit != m_charge_buffer.end() && deposit->hitsetkey == hitsetkey && deposit->hitkey == hitkey; ++deposit)
+    {
+      neffelectrons += deposit->neffelectrons;
+    }
+
+    if (hitsetkey != current_hitsetkey)
+    {
+      // Use existing hitset or add new one if needed
+      // We need to create the TrkrHitSet if not already made - each TrkrHitSet should correspond to a Tpc readout module
+      hitsetit = hitsetcontainer->findOrAddHitSet(hitsetkey);
+      single_hitsetit = single_hitsetcontainer->findOrAddHitSet(hitsetkey);
+      current_hitsetkey = hitsetkey;
+
+      const auto dead_iter = m_deadChannelMap.find(hitsetkey);
+      dead_channels = (m_maskDeadChannels && dead_iter != m_deadChannelMap.end()) ? &dead_iter->second : nullptr;
+      const auto hot_iter = m_hotChannelMap.find(hitsetkey);
+      hot_channels = (m_maskHotChannels && hot_iter != m_hotChannelMap.end()) ? &hot_iter->second : nullptr;
+    }
+
+    // masked channels are stored with time bin 0
+    const TrkrDefs::hitkey channelkey = TpcDefs::genHitKey(TpcDefs::getPad(hitkey), 0);
+    if (dead_channels && std::find(dead_channels->begin(), dead_channels->end(), channelkey) != dead_channels->end())
+    {
+      continue;
+    }
+    if (hot_channels && std::find(hot_channels->begin(), hot_channels->end(), channelkey) != hot_channels->end())
+    {
+      continue;
+    }
+
+    // See if this hit already exists
+    TrkrHit *hit = hitsetit->second->getHit(hitkey);
+    if (!hit)
+    {
+      // create a new one
+      hit = new TrkrHitv2();
+      hitsetit->second->addHitSpecificKey(hitkey, hit);
+    }
+    // Either way, add the energy to it  -- adc values will be added at digitization
+    hit->addEnergy(neffelectrons);
+
+    tpc_truth_clusterer.addhitset(hitsetkey, hitkey, neffelectrons);
+
+    // repeat for the single_hitsetcontainer
+    TrkrHit *single_hit = single_hitsetit->second->getHit(hitkey);
+    if (!single_hit)
+    {
+      single_hit = new TrkrHitv2();
+      single_hitsetit->second->addHitSpecificKey(hitkey, single_hit);
+    }
+    single_hit->addEnergy(neffelectrons);
+  }
+
+  m_charge_buffer.clear();
+}
 double PHG4TpcPadPlaneReadout::check_phi(const unsigned int side, const double phi, const double radius)
 {
   double new_phi = phi;
@@ -1032,70 +1095,75 @@ void PHG4TpcPadPlaneReadout::makeChannelMask(hitMaskTpc &aMask, const std::strin
 void PHG4TpcPadPlaneReadout::sampaTimeDistribution(double tzero,  std::vector<int> &adc_tbin, std::vector<double> &adc_tbin_share)
 {
   // tzero is the arrival time of the electron at the GEM
-  // Ts is the sampa peaking time
-  // Assume the response is over after 8 clock cycles (400 ns)
-  int nclocks = 8;
-
-  double tstepsize = LayerGeom->get_zstep();
+  // the shares only depend on where tzero sits inside its clock bin,
+  // so they are interpolated from the table filled in buildSampaKernel
   int tbinzero = LayerGeom->get_zbin(tzero);
-
-  // the first clock bin is a special case
-  double tfirst_end = LayerGeom->get_zcenter(tbinzero) + tstepsize/2.0;
-  double vfirst_end =  sampaShapingResponseFunction(tzero, tfirst_end); 
-  double first_integral = (vfirst_end / 2.0) * (tfirst_end - tzero);
-    
+  const double phase = (tzero - LayerGeom->get_zcenter(tbinzero)) / m_sampa_kernel_tstep + 0.5;
+  const double x = std::clamp(phase, 0., 1.) * m_sampa_kernel_nphase;
+  const int iphase = std::min(static_cast<int>(x), m_sampa_kernel_nphase - 1);
+  const double frac = x - iphase;
+  const double *kernel_low = &m_sampa_kernel[iphase * m_sampa_nclocks];
+  const double *kernel_high = kernel_low + m_sampa_nclocks;
+
+  // the first clock bin is a special case, it is always kept
   adc_tbin.push_back(tbinzero);
-  adc_tbin_share.push_back(first_integral);
+  adc_tbin_share.push_back((1. - frac) * kernel_low[0] + frac * kernel_high[0]);
 
-  /*
-  if (LayerGeom->get_layer() == print_layer)
+  for (int iclock = 1; iclock < m_sampa_nclocks; ++iclock)
+  {
+    int tbin = tbinzero + iclock;
+    if (tbin < 0 || tbin > LayerGeom->get_zbins())
     {
-      std::cout << "     tzero " << tzero << " tbinzero " << tbinzero << " iclock  0 "  
-		<< " tfirst_end " << tfirst_end << " vfirst_end " << vfirst_end << " first_integral " << first_integral << std::endl;      
+      if (Verbosity() > 0)
+      {
+        std::cout << " t bin " << tbin << " is outside range of " << LayerGeom->get_zbins() << " so skip it" << std::endl;
+      }
+      continue;
     }
-  */
-  
-  for(int iclock = 1; iclock < nclocks; ++iclock)
-    {
-      int tbin = tbinzero + iclock;
-      if (tbin < 0 || tbin > LayerGeom->get_zbins())
-	{
-	  if (Verbosity() > 0)
-	    {
-	      std::cout << " t bin " << tbin << " is outside range of " << LayerGeom->get_zbins() << " so skip it" << std::endl;
-	    }
-	  continue;
-	}
 
-      // get the beginning and end of this clock bin
-      double tcenter = LayerGeom->get_zcenter(tbin);
-      double tlow = tcenter - tstepsize/2.0;
+    adc_tbin.push_back(tbin);
+    adc_tbin_share.push_back((1. - frac) * kernel_low[iclock] + frac * kernel_high[iclock]);
+  }
+}
 
-      // sample the voltage in this bin at nsamples-1 locations
+void PHG4TpcPadPlaneReadout::buildSampaKernel(const double tstepsize)
+{
+  // tabulate the integrated SAMPA response per clock bin, for electrons arriving
+  // at m_sampa_kernel_nphase+1 evenly spaced positions inside the first clock bin.
+  // Time is measured relative to the center of that bin
+  // Assume the response is over after 8 clock cycles (400 ns)
+  m_sampa_kernel_tstep = tstepsize;
+  m_sampa_kernel.assign((m_sampa_kernel_nphase + 1) * m_sampa_nclocks, 0);
+  for (int iphase = 0; iphase <= m_sampa_kernel_nphase; ++iphase)
+  {
+    const double tzero = tstepsize * (static_cast<double>(iphase) / m_sampa_kernel_nphase - 0.5);
+    double *kernel = &m_sampa_kernel[iphase * m_sampa_nclocks];
+
+    // the first clock bin is a special case
+    double tfirst_end = tstepsize / 2.0;
+    double vfirst_end = sampaShapingResponseFunction(tzero, tfirst_end);
+    kernel[0] = (vfirst_end / 2.0) * (tfirst_end - tzero);
+
+    for (int iclock = 1; iclock < m_sampa_nclocks; ++iclock)
+    {
+      // get the beginning of this clock bin
+      double tlow = iclock * tstepsize - tstepsize / 2.0;
+
+      // sample the voltage in this bin at nsamples locations
       int nsamples = 6;
       double sample_step = tstepsize / (double) nsamples;
       double sintegral = 0;
-      for(int isample = 0; isample < nsamples; ++isample)
-	{
-	  double tnow = tlow + (double) isample * sample_step + sample_step / 2.0;	  
-	  double vnow = sampaShapingResponseFunction(tzero, tnow);
-	  sintegral += vnow * sample_step;
-
-	  /*
-	  if (LayerGeom->get_layer() == print_layer)
-	    {
-	      std::cout << "     tzero " << tzero << " tbinzero " << tbinzero << " iclock " << iclock << " tbin " << tbin << " isample " << isample
-			<< " tnow " << tnow << " vnow " << vnow  << " sintegral " << sintegral << std::endl;
-	    }
-	  */
-	}
-
-	  
-      adc_tbin.push_back(tbin);
-      adc_tbin_share.push_back(sintegral);      
+      for (int isample = 0; isample < nsamples; ++isample)
+      {
+        double tnow = tlow + (double) isample * sample_step + sample_step / 2.0;
+        double vnow = sampaShapingResponseFunction(tzero, tnow);
+        sintegral += vnow * sample_step;
+      }
+      kernel[iclock] = sintegral;
     }
+  }
 }
-  
+
 double PHG4TpcPadPlaneReadout::sampaShapingResponseFunction(double tzero, double t) const
   {
     double v = exp(-4*(t-tzero)/Ts) * pow( (t-tzero)/Ts, 4.0);
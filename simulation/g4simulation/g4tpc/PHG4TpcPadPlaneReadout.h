@@ -48,6 +48,9 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
 
   void MapToPadPlane(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc * /*hittruthassoc*/, const double x_gem, const double y_gem, const double t_gem, const unsigned int side, PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) override;
 
+  //! map all electrons of a g4hit, the hitsets are updated once per pad and time bin
+  void MapToPadPlane(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer, TrkrHitTruthAssoc * /*hittruthassoc*/, const ElectronBatch &electrons, PHG4HitContainer::ConstIterator hiter, TNtuple * /*ntpad*/, TNtuple * /*nthit*/) override;
+
   void SetDefaultParameters() override;
   void UpdateInternalParameters() override;
  
@@ -67,6 +70,31 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
   }
 
  private:
+  //! charge of one electron on one pad and time bin, before it is added to the hitsets
+  struct ChargeDeposit
+  {
+    TrkrDefs::hitsetkey hitsetkey;
+    TrkrDefs::hitkey hitkey;
+    float neffelectrons;
+  };
+
+  //! radial extent of a readout layer
+  struct LayerBounds
+  {
+    double rad_low;
+    double rad_high;
+    PHG4TpcGeom *geom;
+  };
+
+  //! amplify one electron and spread its charge into m_charge_buffer
+  void depositElectron(const double x_gem, const double y_gem, const double t_gem, const unsigned int side, PHG4HitContainer::ConstIterator hiter);
+
+  //! add the summed contents of m_charge_buffer to the hitsets and the truth clusterer, then clear it
+  void flushChargeBuffer(TpcClusterBuilder &tpc_truth_clusterer, TrkrHitSetContainer *single_hitsetcontainer, TrkrHitSetContainer *hitsetcontainer);
+
+  //! tabulate the SAMPA time response versus arrival time inside a clock bin
+  void buildSampaKernel(const double tstepsize);
+
   //  void populate_rectangular_phibins(const unsigned int layernum, const double phi, const double cloud_sig_rp, std::vector<int> &pad_phibin, std::vector<double> &pad_phibin_share);
   void populate_zigzag_phibins(const unsigned int side, const unsigned int layernum, const double phi, const double cloud_sig_rp, std::vector<int> &phibin_pad, std::vector<double> &phibin_pad_share);
 
@@ -80,6 +108,28 @@ class PHG4TpcPadPlaneReadout : public PHG4TpcPadPlane
   PHG4TpcGeomContainer *GeomContainer = nullptr;
   PHG4TpcGeom *LayerGeom = nullptr;
 
+  //! layer whose sector boundaries are currently in sector_min_Phi/sector_max_Phi
+  PHG4TpcGeom *m_sector_phi_geom = nullptr;
+
+  std::vector<LayerBounds> m_layer_bounds;
+
+  ///@name scratch space, reused from one electron to the next
+  //@{
+  std::vector<ChargeDeposit> m_charge_buffer;
+  std::vector<int> m_pad_phibin;
+  std::vector<double> m_pad_phibin_share;
+  std::vector<int> m_adc_tbin;
+  std::vector<double> m_adc_tbin_share;
+  //@}
+
+  ///@name SAMPA response per clock bin, for m_sampa_kernel_nphase+1 arrival times
+  //@{
+  static constexpr int m_sampa_nclocks {8};
+  static constexpr int m_sampa_kernel_nphase {64};
+  double m_sampa_kernel_tstep {std::numeric_limits<double>::quiet_NaN()};
+  std::vector<double> m_sampa_kernel;
+  //@}
+
   double neffelectrons_threshold {std::numeric_limits<double>::quiet_NaN()};
 
   std::array<double, 3> MinRadius{};
@@ -45,6 +45,23 @@ double CaloWaveformSim::template_function(double *x, double *par)
   return v1;
 }
 
+double CaloWaveformSim::template_value(const double x) const
+{
+  // same steps as TH1::Interpolate, without the virtual calls
+  const int nbins = m_template_center.size() - 2;
+  if (x <= m_template_center[1])
+  {
+    return m_template_content[1];
+  }
+  if (x >= m_template_center[nbins])
+  {
+    return m_template_content[nbins];
+  }
+  const int xbin = h_template->GetXaxis()->FindFixBin(x);
+  const int bin = (x <= m_template_center[xbin]) ? xbin - 1 : xbin;
+  return m_template_content[bin] + (x - m_template_center[bin]) * m_template_slope[bin];
+}
+
 CaloWaveformSim::CaloWaveformSim(const std::string &name)
   : SubsysReco(name)
 {
@@ -221,7 +238,32 @@ int CaloWaveformSim::InitRun(PHCompositeNode *topNode)
   }
 
   // Prepare waveform buffers
-  m_waveforms.assign(m_nchannels, std::vector<float>(m_nsamples));
+  m_waveforms.assign(static_cast<size_t>(m_nchannels) * m_nsamples, 0.);
+
+  // cache the template bins, TF1::Eval and TH1::Interpolate dominate the
+  // waveform building otherwise
+  const int nbins = h_template->GetNbinsX();
+  m_template_center.assign(nbins + 2, 0.);
+  m_template_content.assign(nbins + 2, 0.);
+  m_template_slope.assign(nbins + 2, 0.);
+  for (int bin = 0; bin <= nbins + 1; bin++)
+  {
+    m_template_center[bin] = h_template->GetBinCenter(bin);
+    m_template_content[bin] = h_template->GetBinContent(bin);
+  }
+  for (int bin = 0; bin <= nbins; bin++)
+  {
+    m_template_slope[bin] = (m_template_content[bin + 1] - m_template_content[bin]) / (m_template_center[bin + 1] - m_template_center[bin]);
+  }
+
+  // template peak position, does not change from event to event
+  TF1 *f_fit = new TF1(
+      "f_fit", [this](double *x, double *par)
+      { return this->template_function(x, par); },
+      0, m_nsamples, 3);
+  f_fit->SetParameters(1.0, 0.0, 0.0);
+  m_template_peak = f_fit->GetMaximumX();
+  delete f_fit;
 
   // Create node tree and finish
   CreateNodeTree(topNode);
@@ -263,27 +305,13 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
   }
 
   // initialize the waveform
-  for (auto &waveform : m_waveforms)
-  {
-    for (auto &sample : waveform)
-    {
-      sample = 0.;
-    }
-  }
-  // waveform TH1
-  TF1 *f_fit = new TF1(
-      "f_fit", [this](double *x, double *par)
-      { return this->template_function(x, par); },
-      0, m_nsamples, 3);
-  f_fit->SetParameter(0, 1.0);
-  f_fit->SetParameter(1, 0.0);
-  float template_peak = f_fit->GetMaximumX();
+  std::fill(m_waveforms.begin(), m_waveforms.end(), 0.);
+
+  const float template_peak = m_template_peak;
   float shift_of_shift = m_timeshiftwidth * gsl_rng_uniform(m_RandomGenerator);
 
   float _shiftval = m_peakpos + shift_of_shift - template_peak;
 
-  f_fit->SetParameters(1, _shiftval, 0);
-
   // get G4Hits
   std::string nodename = "G4HIT_" + m_detector;
   PHG4HitContainer *hits = findNode::getClass<PHG4HitContainer>(topNode, nodename);
@@ -364,10 +392,13 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
     edepMap[hit->get_hit_id()] += hitEdep;
     showerMap[showerID] += hitEdep;
 
-    f_fit->SetParameters(ADC, _shiftval + t0, 0.);
+    // ADC * template(i - shift), same values as the former TF1 evaluation
+    const double amplitude = ADC;
+    const double shift = _shiftval + t0;
+    float *waveform = &m_waveforms[static_cast<size_t>(tower_index) * m_nsamples];
     for (int i = 0; i < m_nsamples; i++)
     {
-      m_waveforms.at(tower_index).at(i) += f_fit->Eval(i);
+      waveform[i] += amplitude * template_value(i - shift);
     }
   }
 
@@ -386,10 +417,11 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
     }
   }
 
+  std::vector<float> m_waveform_pedestal(m_nsamples);
   for (int i = 0; i < m_nchannels; i++)
   {
-    std::vector<float> m_waveform_pedestal;
-    m_waveform_pedestal.resize(m_nsamples);
+    float *waveform = &m_waveforms[static_cast<size_t>(i) * m_nsamples];
+    TowerInfo *tower = m_CaloWaveformContainer->get_tower_at_channel(i);
     if (m_noiseType == NoiseType::NOISE_TREE)
     {
       TowerInfo *pedestal_tower = m_PedestalContainer->get_tower_at_channel(i);
@@ -409,26 +441,22 @@ int CaloWaveformSim::process_event(PHCompositeNode *topNode)
     {
       if (m_noiseType == NoiseType::NOISE_TREE)
       {
-        // TowerInfo *pedestal_tower = m_PedestalContainer->get_tower_at_channel(i);
-        // m_waveforms.at(i).at(j) += (j < m_pedestalsamples) ? pedestal_tower->get_waveform_value(j) : pedestal_tower->get_waveform_value(m_pedestalsamples - 1);
-        m_waveforms.at(i).at(j) += m_waveform_pedestal.at(j);
+        waveform[j] += m_waveform_pedestal[j];
       }
       if (m_noiseType == NoiseType::NOISE_GAUSSIAN)
       {
-        m_waveforms.at(i).at(j) += gsl_ran_gaussian(m_RandomGenerator, m_gaussian_noise);
+        waveform[j] += gsl_ran_gaussian(m_RandomGenerator, m_gaussian_noise);
       }
       if (m_noiseType == NoiseType::NOISE_NONE)
       {
-        m_waveforms.at(i).at(j) += m_fixpedestal;
+        waveform[j] += m_fixpedestal;
       }
       // saturate at 2^14 - 1
-      m_waveforms.at(i).at(j) = std::min<__gnu_cxx::__alloc_traits<class std::allocator<float> >::value_type>(m_waveforms.at(i).at(j), 16383);
-      m_waveforms.at(i).at(j) = std::max<__gnu_cxx::__alloc_traits<class std::allocator<float> >::value_type>(m_waveforms.at(i).at(j), 0);
+      waveform[j] = std::clamp<float>(waveform[j], 0, 16383);
 
-      m_CaloWaveformContainer->get_tower_at_channel(i)->set_waveform_value(j, m_waveforms.at(i).at(j));
+      tower->set_waveform_value(j, waveform[j]);
     }
   }
-  delete f_fit;
   return Fun4AllReturnCodes::EVENT_OK;
 }
 
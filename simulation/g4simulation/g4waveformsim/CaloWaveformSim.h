@@ -217,7 +217,7 @@ class CaloWaveformSim : public SubsysReco
   gsl_rng *m_RandomGenerator{nullptr};
   PHG4CylinderCellGeom_Spacalv1 *geo{nullptr};
   const PHG4CylinderGeom_Spacalv3 *layergeom{nullptr};
-  std::vector<std::vector<float>> m_waveforms;
+  std::vector<float> m_waveforms;  // m_nchannels x m_nsamples, channel by channel
   int m_runNumber{0};
 
   unsigned int (*encode_tower)(unsigned int, unsigned int){TowerInfoDefs::encode_emcal};
@@ -226,6 +226,11 @@ class CaloWaveformSim : public SubsysReco
   CDBTTree *cdbttree{nullptr}, *cdbttree_MC{nullptr};
   CDBTTree *cdbttree_time{nullptr}, *cdbttree_MC_time{nullptr};
   TProfile *h_template{nullptr};
+  // h_template bin centers, contents and slopes to the next bin, indexed by bin number
+  std::vector<double> m_template_center;
+  std::vector<double> m_template_content;
+  std::vector<double> m_template_slope;
+  float m_template_peak{0};
   LightCollectionModel light_collection_model;
 
   NoiseType m_noiseType{NOISE_TREE};
@@ -236,6 +241,8 @@ class CaloWaveformSim : public SubsysReco
                     unsigned short &phibin,
                     float &correction);
   double template_function(double *x, double *par);
+  // h_template->Interpolate(x) from the cached bins
+  double template_value(double x) const;
 };
 
 #endif  // G4WAVEFORMSIM_CALOWAVEFORMSIM_H